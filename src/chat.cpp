@@ -5,8 +5,6 @@
 #include <cstdio>
 #include <iostream>
 #include <map>
-#include <codecvt>
-#include <locale>
 
 #include <raylib.h>
 
@@ -15,8 +13,19 @@
 #include "config.h"
 #include "tgclient.h"
 
-#define MESSAGES_CAPACITY 10
-#define MSG_COUNT_TO_LOAD_WHEN_OPEN_CHAT MESSAGES_CAPACITY
+#define MSG_STORE_CHUNK_SIZE          64 // Messages in a chunk of the message store
+#define MSG_STORE_INIT_CHUNK_CAPACITY 16 // Power of two
+#define MSG_COUNT_TO_LOAD_WHEN_OPEN_CHAT 10
+#define HISTORY_MAX_REQUESTS_TO_OPEN_CHAT 4
+#define HISTORY_PAGE_SIZE       50 // Messages in one request of history, TDLib returns 100 at most
+#define HISTORY_PAGES_IN_FLIGHT 2  // Pages of the current chat and of a chat that was left
+#define HISTORY_MAX_RETRIES     3  // Pages in a row without new messages after which history is not requested anymore
+#define HISTORY_RETRY_DELAY     0.5  // Seconds before a page is requested again, doubled for every failure in a row
+#define HISTORY_RETRY_MAX_DELAY 30.0
+#define LAYOUTS_PER_CLOCK_CHECK 8 // Messages laid out between reads of the frame budget clock
+#define CHAT_SCROLL_STEP      (1.0f/120) // Seconds of one step of the scroll easing
+#define CHAT_SCROLL_MAX_STEPS 30
+#define MSG_REPLY_PREVIEW_MAX_LEN 256 // In bytes. Only one line of the reply is drawn
 
 #define TED_MAX_MSG_LEN         4096
 #define TED_MAX_PLACEHOLDER_LEN 32
@@ -41,27 +50,6 @@ typedef std::wstring_view Arg;
 
 typedef void (*Command)();
 
-struct WStr {
-    wchar_t *data;
-    size_t len;
-
-    static WStr from(const char *cstr)
-    {
-        WStr result = {};
-        result.data = (wchar_t *) LoadCodepoints(cstr, (int *)&result.len);
-        return result;
-    }
-
-    static WStr copy(WStr from)
-    {
-        WStr result = {};
-        result.data = (wchar_t *) calloc(from.len, sizeof(wchar_t));
-        memcpy(result.data, from.data, from.len*sizeof(wchar_t));
-        result.len = from.len;
-        return result;
-    }
-};
-
 enum WidgetTag {
 #define X(tag_name, ...) tag_name,
     LIST_OF_WIDGETS
@@ -74,22 +62,63 @@ struct Widget {
     Vector2 size;
 };
 
+// Messages come with an estimated size and are laid out in 'layout_pending_msgs'
+enum MsgLayout {
+    MSG_LAYOUT_ESTIMATED, // The text is not measured yet
+    MSG_LAYOUT_STALE,     // The text is measured, but the size is for another width
+    MSG_LAYOUT_EXACT,
+};
+
 struct Msg {
     std::int64_t id;
-    WStr text;
-    common::Lines text_lines;
-    std::wstring_view sender_name;
+    std::string *text; // UTF-8 taken from the message. Behind a pointer so messages stay plain data
+    common::Utf8Lines text_lines;
+    tgclient::NameHandle sender_name;
     bool is_mine;
+    MsgLayout layout;
     Vector2 size;
     size_t widget_count;
     Widget widgets[WidgetTag::COUNT];
     bool has_reply_to;
     struct {
         std::int64_t id;
-        WStr text;
-        std::wstring_view sender_name;
+        char *text; // UTF-8 beginning of the text
+        size_t text_len;
+        tgclient::NameHandle sender_name;
         bool is_mine;
     } reply_to;
+    std::int64_t pending_reply_to_id; // Replied message that is not loaded yet, 0 if none
+};
+
+struct MsgChunk {
+    Msg msgs[MSG_STORE_CHUNK_SIZE];
+    // Heights with 'MSG_DISTANCE' of the messages before every slot. Slots
+    // without a message count as zero
+    float tops[MSG_STORE_CHUNK_SIZE + 1];
+    bool are_tops_dirty;
+    size_t pending_layout_count; // Messages without 'MSG_LAYOUT_EXACT'
+};
+
+// Request of older messages. Responses of a chat that was left are dropped
+struct HistoryPage {
+    std::int64_t chat_id;
+    bool is_in_flight;
+};
+
+// Deque of messages in chunks that never move, index 0 is the oldest
+// message. Chunk pointers are kept in a ring, so both ends grow in O(1)
+struct MsgStore {
+    MsgChunk **chunks;  // Ring of 'chunk_cap' pointers
+    size_t chunk_cap;
+    size_t first_chunk; // Ring index of the chunk with the oldest message
+    size_t chunk_count;
+    size_t first;       // Index of the oldest message in its chunk
+    size_t len;
+
+    // Top of every chunk and the bottom of the last one, counted from the
+    // top of the oldest message. Recomputed by 'store_update_tops'
+    float *chunk_tops;
+    bool are_tops_dirty;
 };
 
 enum Motion {
@@ -116,13 +145,46 @@ static void ted_delete_symbols(size_t count);
 static void ted_delete_word();
 static void ted_delete_line();
 static void ted_move_cursor_to_ptr(wchar_t *ptr);
+static void ted_move_cursor_to_point(Vector2 point);
 static void ted_clear();
 static void ted_run_command();
 
 // Declare message list functions
-static void load_msgs(td_api::object_ptr<td_api::messages> msgs);
-static void push_msg(td_api::object_ptr<td_api::message> msg);
+static void fetch_history();
+static void receive_history_page(size_t slot, td_api::object_ptr<td_api::Object> obj);
+template<size_t slot>
+static void receive_history_page(td_api::object_ptr<td_api::Object> obj);
+static void delay_history(size_t failure_count);
+static void push_msg(td_api::object_ptr<td_api::message> msg, bool is_older);
 static Msg *find_msg(std::int64_t msg_id);
+static void set_reply_to(Msg *msg, Msg *reply_to);
+static void add_pending_reply(Msg *msg);
+static void resolve_pending_replies(size_t new_count);
+static void unload_msg(Msg *msg);
+static size_t msg_memory(Msg *msg);
+static Msg *msg_at(size_t idx);
+static size_t msg_idx(Msg *msg);
+static MsgChunk *store_chunk(size_t chunk_idx);
+static Msg *store_push(bool at_front);
+static void store_pop(bool at_front);
+static void store_clear();
+static void store_mark_height_dirty(size_t idx);
+static void store_update_tops();
+static float msg_top(size_t idx);
+static float msg_list_height();
+static size_t find_msg_at(float y);
+static void estimate_msg_size(Msg *msg);
+static void layout_msg(size_t idx);
+static void layout_pending_msgs();
+static void add_pending_layout(size_t idx, int delta);
+static size_t find_pending_msg(size_t from, bool is_older);
+static size_t first_visible_msg();
+static size_t last_visible_msg();
+static void update_msg_tops();
+static void update_scroll();
+static void resize_chat_view(float width);
+static void mark_msgs_stale();
+static float chat_view_bottom();
 
 // Declare util functions
 static std::int64_t to_int64_t(std::wstring_view text);
@@ -138,11 +200,33 @@ LIST_OF_WIDGETS
 // GLOBAL STATE //////////////////////////////
 
 // Message list global state
-static Msg    chat_messages[MESSAGES_CAPACITY];
-static size_t chat_message_count = 0;
+static MsgStore chat_msgs;
+static size_t chat_memory_used = 0; // By the messages in 'chat_msgs', see 'msg_memory'
+static size_t chat_pending_layout_count = 0; // Messages without 'MSG_LAYOUT_EXACT'
 static size_t chat_selection_offset = 0;
 static std::int64_t chat_id = 0;
-static float constexpr max_msg_widget_width = floor(CHAT_VIEW_WIDTH - BoxModel::MSG_LM - BoxModel::MSG_LP - BoxModel::MSG_RP - BoxModel::MSG_RM);
+static HistoryPage history_pages[HISTORY_PAGES_IN_FLIGHT];
+static bool history_is_complete = false; // The oldest message of the chat is loaded
+static size_t history_open_request_count = 0;
+static size_t history_retry_count = 0; // Pages in a row that brought nothing new
+static size_t history_error_count = 0; // Requests in a row that failed
+static double history_retry_time = 0;  // 'GetTime' before which no page is requested
+static Msg **chat_pending_replies = nullptr; // Messages with 'pending_reply_to_id'. They never move, see 'MsgStore'
+static size_t chat_pending_reply_count = 0;
+static size_t chat_pending_reply_cap = 0;
+// Every slot of 'history_pages' has its own handler, that is how a response finds its request
+static void (*history_page_handlers[HISTORY_PAGES_IN_FLIGHT])(td_api::object_ptr<td_api::Object>) = {
+    receive_history_page<0>,
+    receive_history_page<1>,
+};
+static float chat_view_width; // 'CHAT_VIEW_WIDTH' or the window width if it is narrower
+static float chat_scroll = 0; // From the bottom of the newest message to the bottom of the view
+static float chat_scroll_target = 0;
+static float chat_scroll_time = 0; // Frame time that is not stepped by the easing yet
+static size_t chat_scroll_anchor = 0; // Message at the bottom of the view while it is scrolled up
+static float chat_scroll_anchor_y = 0; // Bottom of the view from the top of the anchor
+static float max_msg_widget_width;
+static std::uint32_t chat_name_generation = 0; // Of the names in the laid out messages
 static struct {
     Vector2 (*size_fn)  (Msg *msg_data);
     void    (*render_fn)(Msg *msg_data, Vector2 pos, float width);
@@ -157,13 +241,13 @@ static common::Lines ted_lines;
 static Pos           ted_cursor_pos;
 static bool          ted_cursor_has_space = false;
 static float         ted_max_line_width;
+static Vector2       ted_text_pos; // Set by render for mouse hit testing
 static wchar_t       ted_buffer[TED_MAX_MSG_LEN];
 static size_t        ted_buffer_len = 0;
 static wchar_t       ted_placeholder[TED_MAX_PLACEHOLDER_LEN];
 static size_t        ted_placeholder_len;
 static Arg           ted_args[TED_ARGS_CAPACITY];
 static size_t        ted_arg_count = 0;
-static std::wstring_convert<std::codecvt_utf8<wchar_t>> converter;
 static std::map<std::wstring_view, Command> command_map = {
 #define X(name, func_name) { name, func_name },
     LIST_OF_COMMANDS
@@ -179,11 +263,25 @@ void chat::init()
     ted_lines.items[0].text = ted_buffer;
     ted_lines.items[0].len = 0;
     ted_cursor_pos = Pos{};
+    resize_chat_view(floor(fminf(CHAT_VIEW_WIDTH, GetScreenWidth())));
 }
 
 void chat::update()
 {
-    if      (KEYMAP_SELECT_PREV)        { if (chat_selection_offset < chat_message_count) { chat_selection_offset += 1; } }
+    // Messages are wrapped again only when the chat view width changes
+    float width = floor(fminf(CHAT_VIEW_WIDTH, GetScreenWidth()));
+    if (width != chat_view_width) resize_chat_view(width);
+    // Names are part of the message width, a rename or a name that
+    // arrived after the message lays it out again
+    if (tgclient::name_generation() != chat_name_generation) {
+        chat_name_generation = tgclient::name_generation();
+        mark_msgs_stale();
+    }
+    layout_pending_msgs();
+    update_scroll();
+    fetch_history();
+
+    if      (KEYMAP_SELECT_PREV)        { if (chat_selection_offset < chat_msgs.len) { chat_selection_offset += 1; } }
     else if (KEYMAP_SELECT_NEXT)        { if (chat_selection_offset > 0) { chat_selection_offset -= 1; } }
     else if (KEYMAP_MOVE_FORWARD)       ted_try_cursor_motion(MOTION_FORWARD);
     else if (KEYMAP_MOVE_BACKWARD)      ted_try_cursor_motion(MOTION_BACKWARD);
@@ -198,6 +296,7 @@ void chat::update()
     else if (KEYMAP_DELETE)             ted_delete_symbols(1);
     else if (KEYMAP_NEW_LINE)           ted_insert_symbol('\n');
     else if (KEYMAP_SEND_MESSAGE)       ted_send();
+    else if (IsMouseButtonPressed(MOUSE_BUTTON_LEFT)) ted_move_cursor_to_point(GetMousePosition());
     else { // just insert char
         int symbol = GetCharPressed();
         if (symbol != 0) ted_insert_symbol(symbol);
@@ -208,27 +307,28 @@ void chat::render()
 {
     DrawFPS(0, 0);
 
-    DrawText(TextFormat("Count: %zu\n", chat_message_count), 0, 24, 24, RAYWHITE);
+    DrawText(TextFormat("Count: %zu\n", chat_msgs.len), 0, 24, 24, RAYWHITE);
 
     float ted_font_size = common::font_size(TED_FONT_ID);
-    Vector2 chat_view_pos = {
-        (GetScreenWidth()/2) - (CHAT_VIEW_WIDTH/2),
-        GetScreenHeight() - (ted_lines.len*ted_font_size +
-                BoxModel::TED_BM + BoxModel::TED_BP +
-                BoxModel::TED_TP + BoxModel::TED_TM)
-    };
+    Vector2 chat_view_pos = { (GetScreenWidth()/2) - (chat_view_width/2), chat_view_bottom() };
 
     { // Render msg list
-        Vector2 msg_pos = { 0, chat_view_pos.y };
-        Msg *end = &chat_messages[-1];
+        // Only messages from the first visible one are drawn, their
+        // positions come from the prefix sums of the heights
+        update_msg_tops();
+        float list_top = chat_view_pos.y + chat_scroll - msg_list_height();
+        Vector2 msg_pos = { 0, 0 };
         Msg *selected_msg = chat_selection_offset > 0 ?
-            &chat_messages[chat_message_count-chat_selection_offset] :
+            msg_at(chat_msgs.len-chat_selection_offset) :
             nullptr;
-        for (Msg *it = &chat_messages[chat_message_count-1]; it != end; it--) {
+        BeginScissorMode(0, 0, GetScreenWidth(), chat_view_pos.y);
+        size_t end = chat_msgs.len == 0 ? 0 : last_visible_msg() + 1;
+        for (size_t idx = first_visible_msg(); idx < end; idx++) {
+            Msg *it = msg_at(idx);
             // Calculate message position
-            msg_pos.y -= it->size.y + MSG_DISTANCE;
+            msg_pos.y = list_top + msg_top(idx);
             if (it->is_mine) {
-                msg_pos.x = chat_view_pos.x + CHAT_VIEW_WIDTH - it->size.x - BoxModel::MSG_LM - BoxModel::MSG_RM;
+                msg_pos.x = chat_view_pos.x + chat_view_width - it->size.x - BoxModel::MSG_LM - BoxModel::MSG_RM;
             } else {
                 msg_pos.x = chat_view_pos.x + BoxModel::MSG_LM;
             }
@@ -242,6 +342,7 @@ void chat::render()
                     { msg_pos.x, msg_pos.y, it->size.x, it->size.y },
                     MSG_REC_ROUNDNESS/it->size.y, MSG_REC_SEGMENT_COUNT,
                     msg_color_palette[it->is_mine].bg_color);
+            if (it->layout != MSG_LAYOUT_EXACT) continue;
 
             // Render message widgets
             float curr_max_msg_widget_width = it->size.x - BoxModel::MSG_LP - BoxModel::MSG_RP;
@@ -252,112 +353,14 @@ void chat::render()
                 widget_pos.y += it->widgets[i].size.y;
             }
         }
+        common::flush_text();
+        EndScissorMode();
     }
 
-    /* { // Render msg list */
-    /*     // Calculate max line width */
-    /*     float max_msg_line_width = */
-    /*         floor(CHAT_VIEW_WIDTH - */
-    /*                 BoxModel::MSG_LM - BoxModel::MSG_LP - */
-    /*                 BoxModel::MSG_RP - BoxModel::MSG_RM); */
-    /**/
-    /*     int selected_msg_idx = chat_message_count - chat_selection_offset; */
-    /**/
-    /*     float chat_view_bot_pos_y = height -  */
-    /*         (ted_lines.len*ted_font_size + */
-    /*         BoxModel::TED_BM + BoxModel::TED_BP + */
-    /*         BoxModel::TED_TP + BoxModel::TED_TM); */
-    /**/
-    /*     // TODO: I think it's terrible */
-    /*     // ================== */
-    /*     // Calculate chat_view's start message idx and start y */
-    /*     float msg_list_bot_pos_y = chat_view_bot_pos_y + offset; */
-    /*     float y_with_scroll = msg_list_bot_pos_y + scroll; */
-    /*     if (msg_list_height >= chat_view_bot_pos_y) { */
-    /*         if (y_with_scroll < chat_view_bot_pos_y && msg_begin_idx+1 == chat_message_count) { */
-    /*             msg_list_bot_pos_y = chat_view_bot_pos_y; */
-    /*         } else if (y_with_scroll < height && msg_begin_idx+1 < chat_message_count) { */
-    /*             msg_begin_idx += 1; */
-    /*             msg_list_bot_pos_y += scroll; */
-    /*             msg_list_bot_pos_y += MSG_DISTANCE + calc_msg_height(msg_begin_idx, max_msg_line_width); */
-    /*         } else if (y_with_scroll-msg_list_height > MSG_DISTANCE) { */
-    /*             msg_list_bot_pos_y = MSG_DISTANCE + msg_list_height; */
-    /*         } else { */
-    /*             msg_list_bot_pos_y += scroll; */
-    /*             for (; msg_begin_idx >= 0; msg_begin_idx--) { */
-    /*                 float msg_height = calc_msg_height(msg_begin_idx, max_msg_line_width); */
-    /*                 if (msg_list_bot_pos_y-msg_height-MSG_DISTANCE < height) break; */
-    /*                 msg_list_bot_pos_y -= msg_height + MSG_DISTANCE; */
-    /*             } */
-    /*         } */
-    /*     } */
-    /**/
-    /*     float heights[WidgetTag::COUNT]; */
-    /*     Rectangle msg_rect = { BoxModel::MSG_LM, msg_list_bot_pos_y, 0, 0 }; */
-    /*     for (int i = msg_begin_idx; i >= 0; i--) { */
-    /*         if (msg_rect.y < 0) break; */
-    /**/
-    /*         WidgetTag *widgets = chat_messages[i].widgets; */
-    /*         size_t widget_count = chat_messages[i].widget_count; */
-    /**/
-    /*         // Calculate message rectangle size */
-    /*         msg_rect.width = 0; */
-    /*         msg_rect.height = (widget_count-1) * MSG_WIDGET_DISTANCE; */
-    /*         size_t height_count = 0; */
-    /*         for (size_t j = 0; j < widget_count; j++) { */
-    /*             Vector2 size = widget_vtable[widgets[j]].size_fn( */
-    /*                     &chat_messages[i], */
-    /*                     max_msg_line_width); */
-    /*             heights[height_count++] = size.y; */
-    /*             msg_rect.height += size.y; */
-    /*             if (size.x > msg_rect.width) msg_rect.width = size.x; */
-    /*         } */
-    /**/
-    /*         // Calculate position */
-    /*         msg_rect.width += BoxModel::MSG_LP + BoxModel::MSG_RP; */
-    /*         msg_rect.height += BoxModel::MSG_TP + BoxModel::MSG_BP; */
-    /*         msg_rect.y -= msg_rect.height + MSG_DISTANCE; */
-    /*         if (chat_messages[i].is_mine) { */
-    /*             msg_rect.x = chat_view_x + CHAT_VIEW_WIDTH - msg_rect.width - BoxModel::MSG_LM - BoxModel::MSG_RM; */
-    /*         } else { */
-    /*             msg_rect.x = chat_view_x + BoxModel::MSG_LM; */
-    /*         } */
-    /**/
-    /*         // Render selection if the message is selected */
-    /*         if (i == selected_msg_idx) { */
-    /*             DrawRectangle(0, msg_rect.y, GetScreenWidth(), msg_rect.height, MSG_SELECTED_COLOR); */
-    /*         } */
-    /**/
-    /*         // Render message rectangle */
-    /*         DrawRectangleRounded( */
-    /*                 msg_rect, MSG_REC_ROUNDNESS/msg_rect.height, MSG_REC_SEGMENT_COUNT, */
-    /*                 msg_color_palette[chat_messages[i].is_mine].bg_color); */
-    /**/
-    /*         // Render message widgets */
-    /*         Vector2 pos = { msg_rect.x+BoxModel::MSG_LP, msg_rect.y+BoxModel::MSG_TP }; */
-    /*         for (size_t j = 0; j < widget_count; j++) { */
-    /*             widget_vtable[widgets[j]].render_fn( */
-    /*                     &chat_messages[i], */
-    /*                     pos, max_msg_line_width, */
-    /*                     msg_rect.width - BoxModel::MSG_LP - BoxModel::MSG_RP); */
-    /*             pos.y += heights[j] + MSG_WIDGET_DISTANCE; */
-    /*         } */
-    /*     } */
-    /**/
-    /*     offset = msg_list_bot_pos_y - chat_view_bot_pos_y; */
-    /*     msg_list_height = msg_list_bot_pos_y - msg_rect.y; */
-    /* } */
-
     { // Render text editor
-        // Calculate max line
-        ted_max_line_width =
-            floor(CHAT_VIEW_WIDTH -
-                    BoxModel::TED_LM - BoxModel::TED_LP -
-                    BoxModel::TED_RP - BoxModel::TED_RM);
-
         // Render text editor rectangle
         Rectangle ted_rec = {};
-        ted_rec.width = CHAT_VIEW_WIDTH - BoxModel::TED_LM - BoxModel::TED_RM;
+        ted_rec.width = chat_view_width - BoxModel::TED_LM - BoxModel::TED_RM;
         ted_rec.height = ted_lines.len*ted_font_size + BoxModel::TED_TP + BoxModel::TED_BP;
         ted_rec.x = chat_view_pos.x + BoxModel::TED_LM;
         ted_rec.y = GetScreenHeight() - ted_rec.height - BoxModel::TED_BM;
@@ -365,12 +368,13 @@ void chat::render()
 
         // Render placeholder or text if it exists
         Vector2 pos = { ted_rec.x + BoxModel::TED_LP, ted_rec.y + BoxModel::TED_TP };
+        ted_text_pos = pos;
         if (ted_buffer_len == 0) {
             common::draw_wtext(TED_FONT_ID, pos, ted_placeholder,
                     ted_placeholder_len, TED_PLACEHOLDER_COLOR);
         } else {
             ted_set_placeholder(L"Message...");
-            common::draw_lines(TED_FONT_ID, pos, ted_lines, TED_FG_COLOR);
+            common::draw_lines(TED_FONT_ID, pos, &ted_lines, TED_FG_COLOR);
         }
 
         // Render cursor
@@ -380,6 +384,7 @@ void chat::render()
         pos.y += vec_to_pos.y;
         DrawLine(pos.x, pos.y, pos.x, pos.y+ted_font_size, TED_CURSOR_COLOR);
     }
+    common::flush_text();
 }
 
 void chat::ted_set_placeholder(const wchar_t *text)
@@ -397,7 +402,7 @@ void chat::ted_set_placeholder(const wchar_t *text)
 void chat::update_new_msg(td_api::object_ptr<td_api::updateNewMessage> u)
 {
     if (u->message_->chat_id_ != chat_id) return;
-    push_msg(std::move(u->message_));
+    push_msg(std::move(u->message_), false);
 }
 
 void chat::update_msg_send_succeeded(td_api::object_ptr<td_api::updateMessageSendSucceeded> u)
@@ -413,7 +418,8 @@ static void ted_send()
 {
     if (ted_buffer_len == 0) return;
 
-    std::string text_utf8 = converter.to_bytes(ted_buffer, &ted_buffer[ted_buffer_len]);
+    std::string text_utf8(4*ted_buffer_len, '\0');
+    text_utf8.resize(common::utf32_to_utf8(ted_buffer, ted_buffer_len, &text_utf8[0]));
     switch (tgclient::state) {
     case tgclient::STATE_NONE:
         break;
@@ -446,7 +452,7 @@ static void ted_send()
             if (chat_selection_offset > 0) {
                 send_message->reply_to_ =
                     td_api::make_object<td_api::inputMessageReplyToMessage>(
-                            chat_messages[chat_message_count - chat_selection_offset].id,
+                            msg_at(chat_msgs.len - chat_selection_offset)->id,
                             nullptr);
             }
 
@@ -502,21 +508,20 @@ static void ted_try_cursor_motion(Motion m)
             ted_move_cursor_to_ptr(curr_text_ptr+1);
             return;
 
+        // The cursor keeps its x, not its column
         case MOTION_UP:
             if (p.row > 0) {
+                float x = ted_lines.get_vec_to_pos(TED_FONT_ID, p.row, p.col).x;
                 p.row -= 1;
-                if (p.col >= ted_lines.items[p.row].len) {
-                    p.col = ted_lines.items[p.row].len;
-                }
+                p.col = ted_lines.col_at_x(p.row, x);
             }
             break;
 
         case MOTION_DOWN:
             if (p.row+1 < ted_lines.len) {
+                float x = ted_lines.get_vec_to_pos(TED_FONT_ID, p.row, p.col).x;
                 p.row += 1;
-                if (p.col >= ted_lines.items[p.row].len) {
-                    p.col = ted_lines.items[p.row].len;
-                }
+                p.col = ted_lines.col_at_x(p.row, x);
             }
             break;
 
@@ -539,6 +544,7 @@ static void ted_insert_symbol(int s)
     if (ted_buffer_len+1 >= TED_MAX_MSG_LEN) return;
 
     // move text after cursor
+    size_t old_buffer_len = ted_buffer_len;
     wchar_t *text_curr_ptr = &ted_lines.items[ted_cursor_pos.row].text[ted_cursor_pos.col+ted_cursor_has_space];
     wchar_t *text_end_ptr = &ted_buffer[ted_buffer_len];
     size_t size = (text_end_ptr - text_curr_ptr) * sizeof(int);
@@ -546,6 +552,7 @@ static void ted_insert_symbol(int s)
 
     *text_curr_ptr = s;
     ted_buffer_len += 1;
+    size_t edit_begin = text_curr_ptr - ted_buffer;
 
     // Interpret unicode literals
     if (s == ':') {
@@ -566,15 +573,18 @@ static void ted_insert_symbol(int s)
                         ted_buffer[insertion_begin] = code;
                         text_curr_ptr = &ted_buffer[insertion_begin];
                         size_t size = ted_buffer_len - i - 1;
-                        memmove(&ted_buffer[insertion_begin+1], &ted_buffer[i+1], size);
+                        memmove(&ted_buffer[insertion_begin+1], &ted_buffer[i+1], size*sizeof(wchar_t));
                         ted_buffer_len -= i - insertion_begin;
+                        if (insertion_begin < edit_begin) edit_begin = insertion_begin;
                     }
                 }
             }
         }
     }
 
-    ted_lines.recalc(TED_FONT_ID, ted_buffer, ted_buffer_len, ted_max_line_width);
+    // Text after the inserted symbol is only shifted
+    ted_lines.rewrap(TED_FONT_ID, ted_buffer, ted_buffer_len, ted_max_line_width,
+            edit_begin, text_curr_ptr+1 - ted_buffer, ted_buffer_len - old_buffer_len);
     ted_move_cursor_to_ptr(text_curr_ptr+1);
 }
 
@@ -591,7 +601,9 @@ static void ted_delete_symbols(size_t count)
     memmove(new_curr_text_ptr, text_curr_ptr, size);
     ted_buffer_len -= text_curr_ptr - new_curr_text_ptr;
 
-    ted_lines.recalc(TED_FONT_ID, ted_buffer, ted_buffer_len, ted_max_line_width);
+    size_t edit_begin = new_curr_text_ptr - ted_buffer;
+    ted_lines.rewrap(TED_FONT_ID, ted_buffer, ted_buffer_len, ted_max_line_width,
+            edit_begin, edit_begin, -(ptrdiff_t) count);
     ted_move_cursor_to_ptr(new_curr_text_ptr);
 }
 
@@ -623,19 +635,8 @@ static void ted_delete_line()
 
 static void ted_move_cursor_to_ptr(wchar_t *text_ptr)
 {
-    Pos pos = { 0, 0 };
-    common::Line line = ted_lines.items[pos.row];
-    size_t real_line_len = line.len + line.trim_whitespace_count;
-    while (&line.text[pos.col] != text_ptr) {
-        if (pos.col >= real_line_len) {
-            if (++pos.row >= ted_lines.len) return;
-            line = ted_lines.items[pos.row];
-            real_line_len = line.len + line.trim_whitespace_count;
-            pos.col = 0;
-        } else {
-            pos.col += 1;
-        }
-    }
+    Pos pos;
+    ted_lines.find_pos(text_ptr, &pos.row, &pos.col);
 
     if (pos.col > ted_max_line_width) {
         pos.col = ted_max_line_width;
@@ -647,12 +648,24 @@ static void ted_move_cursor_to_ptr(wchar_t *text_ptr)
     ted_cursor_pos = pos;
 }
 
+static void ted_move_cursor_to_point(Vector2 point)
+{
+    if (ted_buffer_len == 0) return;
+
+    float row = floor((point.y - ted_text_pos.y) / common::font_size(TED_FONT_ID));
+    if (row < 0 || row >= ted_lines.len) return;
+
+    ted_cursor_pos.row = row;
+    ted_cursor_pos.col = ted_lines.col_at_x(ted_cursor_pos.row, point.x - ted_text_pos.x);
+    ted_cursor_has_space = false;
+}
+
 static void ted_clear()
 {
     ted_buffer_len = 0;
-    ted_lines.len = 0;
     ted_cursor_pos = Pos{};
-    ted_lines.grow_one();
+    ted_lines.clear();
+    ted_lines.items[0].text = ted_buffer;
 }
 
 static void ted_run_command()
@@ -697,10 +710,31 @@ static void ted_run_command()
     res->second();
 }
 
-static void push_msg(td_api::object_ptr<td_api::message> tg_msg)
+// Older messages go to the front of the store, new ones to the back
+static void push_msg(td_api::object_ptr<td_api::message> tg_msg, bool is_older)
 {
     Msg new_msg = {};
 
+    // Over the memory cap new messages drop the oldest ones, which can be
+    // fetched again. Older pages are not fetched over it, so the newest
+    // messages are never dropped. Lines of the first dropped message are
+    // reused, so a full store lays out new messages without allocations
+    while (!is_older && chat_memory_used > CHAT_MESSAGES_MEMORY_CAP && chat_msgs.len > 0) {
+        Msg *evicted = msg_at(0);
+        chat_memory_used -= msg_memory(evicted);
+        if (evicted->layout != MSG_LAYOUT_EXACT) add_pending_layout(0, -1);
+        if (new_msg.text_lines.items == nullptr) {
+            new_msg.text_lines = evicted->text_lines;
+            evicted->text_lines = {};
+        }
+        unload_msg(evicted);
+        store_pop(true);
+        history_is_complete = false;
+
+        // Selection is counted from the newest message
+        if (chat_selection_offset > chat_msgs.len) chat_selection_offset = 0;
+    }
+
     new_msg.id = tg_msg->id_;
     new_msg.is_mine = tg_msg->is_outgoing_;
 
@@ -715,59 +749,49 @@ static void push_msg(td_api::object_ptr<td_api::message> tg_msg)
     }
 
     // Get message text
-    std::string text = "[NONE]";
     if (tg_msg->content_->get_id() == td_api::messageText::ID) {
-        text = static_cast<td_api::messageText &>(*tg_msg->content_).text_->text_;
+        new_msg.text = new std::string(std::move(static_cast<td_api::messageText &>(*tg_msg->content_).text_->text_));
+    } else {
+        new_msg.text = new std::string("[NONE]");
     }
-    new_msg.text = WStr::from(text.c_str());
 
-    if (new_msg.is_mine) {
-        chat_selection_offset = 0;
-    } else {
-        new_msg.widgets[new_msg.widget_count++].tag = WidgetTag::SENDER_NAME;
-        if (chat_selection_offset != 0) {
+    if (!new_msg.is_mine) new_msg.widgets[new_msg.widget_count++].tag = WidgetTag::SENDER_NAME;
+    if (!is_older) {
+        if (new_msg.is_mine) {
+            chat_selection_offset = 0;
+            chat_scroll_target = 0;
+        } else if (chat_selection_offset != 0) {
             chat_selection_offset += 1;
         }
     }
 
-    // Get reply if it exists
+    new_msg.widgets[new_msg.widget_count++].tag = WidgetTag::TEXT;
+
+    // Get reply if it exists. A message of a history page replies to an
+    // older one that is not loaded yet, it is attached after the page
+    std::int64_t reply_to_id = 0;
+    Msg *local_reply_to = nullptr;
     if (tg_msg->reply_to_ != nullptr &&
         tg_msg->reply_to_->get_id() == td_api::messageReplyToMessage::ID) {
-        std::int64_t reply_to_id = static_cast<td_api::messageReplyToMessage&>(
+        reply_to_id = static_cast<td_api::messageReplyToMessage&>(
                 *tg_msg->reply_to_).message_id_;
-        Msg *local_reply_to = find_msg(reply_to_id);
-        if (local_reply_to == nullptr) {
-            std::wcout << "Could not reply to " << reply_to_id << ": not loaded\n";
-        } else {
-            new_msg.has_reply_to = true;
-            new_msg.reply_to.id = local_reply_to->id;
-            new_msg.reply_to.text = WStr::copy(local_reply_to->text);
-            new_msg.reply_to.sender_name = local_reply_to->sender_name;
-            new_msg.reply_to.is_mine = local_reply_to->is_mine;
-            new_msg.widgets[new_msg.widget_count++].tag = WidgetTag::REPLY;
-        }
+        if (!is_older) local_reply_to = find_msg(reply_to_id);
+        if (local_reply_to != nullptr) set_reply_to(&new_msg, local_reply_to);
     }
 
-    new_msg.widgets[new_msg.widget_count++].tag = WidgetTag::TEXT;
-
-    // Calculate message sizes
-    for (size_t i = 0; i < new_msg.widget_count; i++) {
-        Vector2 size = widget_vtable[new_msg.widgets[i].tag].size_fn(&new_msg);
-        new_msg.widgets[i].size = size;
-        new_msg.size.y += size.y;
-        if (size.x > new_msg.size.x) new_msg.size.x = size.x;
-    }
-    new_msg.size.y += BoxModel::MSG_TP + BoxModel::MSG_BP;
-    new_msg.size.x += BoxModel::MSG_LP + BoxModel::MSG_RP;
-
-    if (chat_message_count >= MESSAGES_CAPACITY) {
-        UnloadCodepoints((int*)chat_messages[0].text.data);
-        if (chat_messages[0].has_reply_to) free(chat_messages[0].reply_to.text.data);
-        memmove(&chat_messages[0], &chat_messages[1], (chat_message_count-1)*sizeof(Msg));
-        chat_message_count -= 1;
+    // The layout is left to 'layout_pending_msgs', so a page of history
+    // does not measure all of its text in one frame
+    new_msg.layout = MSG_LAYOUT_ESTIMATED;
+    estimate_msg_size(&new_msg);
+
+    Msg *msg = store_push(is_older);
+    *msg = new_msg;
+    chat_memory_used += msg_memory(msg);
+    add_pending_layout(is_older ? 0 : chat_msgs.len-1, 1);
+    if (reply_to_id != 0 && local_reply_to == nullptr) {
+        msg->pending_reply_to_id = reply_to_id;
+        add_pending_reply(msg);
     }
-
-    chat_messages[chat_message_count++] = new_msg;
 }
 
 /* static float calc_msg_height(size_t msg_idx, float max_msg_line_width) */
@@ -817,82 +841,677 @@ static bool wchar_from_hexstr(const wchar_t *s, size_t len, wchar_t *result)
     return true;
 }
 
-static void load_msgs(td_api::object_ptr<td_api::messages> msgs)
+// Only one page of the current chat is requested at a time: the next one
+// starts from the oldest message of the previous one. Pages come early enough
+// to be laid out before they are scrolled to.
+// TDLib often returns only a part of a page, the first one from its local
+// database especially. What comes is kept and a chat is opened with the next
+// pages until it has 'MSG_COUNT_TO_LOAD_WHEN_OPEN_CHAT' messages, or its
+// start, or 'HISTORY_MAX_REQUESTS_TO_OPEN_CHAT' requests were sent
+static void fetch_history()
 {
-    if (msgs->total_count_ != MSG_COUNT_TO_LOAD_WHEN_OPEN_CHAT) {
-        tgclient::request(
-            td_api::make_object<td_api::getChatHistory>(
-                chat_id, 0, 0, MSG_COUNT_TO_LOAD_WHEN_OPEN_CHAT, false),
-            load_msgs);
-        return;
+    if (chat_id == 0 || history_is_complete) return;
+    if (chat_memory_used >= CHAT_MESSAGES_MEMORY_CAP) return; // See 'push_msg'
+    if (GetTime() < history_retry_time) return;
+
+    bool is_opening = chat_msgs.len < MSG_COUNT_TO_LOAD_WHEN_OPEN_CHAT &&
+        history_open_request_count < HISTORY_MAX_REQUESTS_TO_OPEN_CHAT;
+    if (!is_opening) {
+        store_update_tops();
+        float view_height = chat_view_bottom();
+        float height_above_view = msg_list_height() - chat_scroll - view_height;
+        if (height_above_view > CHAT_HISTORY_PREFETCH_SCREENS*view_height) return;
     }
 
-    for (int i = MSG_COUNT_TO_LOAD_WHEN_OPEN_CHAT-1; i >= 0; i--) {
-        push_msg(std::move(msgs->messages_[i]));
+    size_t free_slot = HISTORY_PAGES_IN_FLIGHT;
+    for (size_t i = 0; i < HISTORY_PAGES_IN_FLIGHT; i++) {
+        HistoryPage *page = &history_pages[i];
+        if (page->is_in_flight && page->chat_id == chat_id) return;
+        if (!page->is_in_flight) free_slot = i;
     }
+    if (free_slot == HISTORY_PAGES_IN_FLIGHT) return;
+
+    // Zero is the newest message of the chat
+    std::int64_t from_msg_id = chat_msgs.len == 0 ? 0 : msg_at(0)->id;
+    if (is_opening) history_open_request_count += 1;
+    history_pages[free_slot].chat_id = chat_id;
+    history_pages[free_slot].is_in_flight = true;
+    tgclient::request(
+        td_api::make_object<td_api::getChatHistory>(
+            chat_id, from_msg_id, 0, HISTORY_PAGE_SIZE, false),
+        history_page_handlers[free_slot]);
+}
+
+// Messages come from the newest to the oldest. The ones that are loaded
+// already are skipped, ids only grow in a chat. Older messages go above the
+// view with estimated sizes, so nothing on the screen moves or is laid out again.
+// Replies are attached after the whole page, their messages come later in it.
+// Only an empty page means the start of the chat. Errors are requested again
+// by 'fetch_history' after a growing delay for as long as they happen, pages
+// without new messages 'HISTORY_MAX_RETRIES' times in a row
+static void receive_history_page(size_t slot, td_api::object_ptr<td_api::Object> obj)
+{
+    HistoryPage *page = &history_pages[slot];
+    assert(page->is_in_flight);
+    page->is_in_flight = false;
+    if (page->chat_id != chat_id) return;
+
+    if (obj->get_id() == td_api::error::ID) {
+        fprintf(stderr, "ERROR: Could not load history: %s\n",
+                static_cast<td_api::error &>(*obj).message_.c_str());
+        history_error_count += 1;
+        delay_history(history_error_count);
+        return;
+    }
+    history_error_count = 0;
+
+    auto &msgs = static_cast<td_api::messages &>(*obj).messages_;
+    size_t received_count = 0;
+    size_t pushed_count = 0;
+    for (size_t i = 0; i < msgs.size(); i++) {
+        if (msgs[i] == nullptr) continue;
+        received_count += 1;
+        if (chat_msgs.len > 0 && msgs[i]->id_ >= msg_at(0)->id) continue;
+        push_msg(std::move(msgs[i]), true);
+        pushed_count += 1;
+    }
+    if (pushed_count > 0) resolve_pending_replies(pushed_count);
+    if (received_count == 0) {
+        history_is_complete = true;
+    } else if (pushed_count == 0) {
+        history_retry_count += 1;
+        if (history_retry_count > HISTORY_MAX_RETRIES) history_is_complete = true;
+        delay_history(history_retry_count);
+    } else {
+        history_retry_count = 0;
+    }
+}
+
+template<size_t slot>
+static void receive_history_page(td_api::object_ptr<td_api::Object> obj)
+{
+    receive_history_page(slot, std::move(obj));
 }
 
+static void delay_history(size_t failure_count)
+{
+    double delay = HISTORY_RETRY_DELAY;
+    for (size_t i = 1; i < failure_count && delay < HISTORY_RETRY_MAX_DELAY; i++) delay *= 2;
+    history_retry_time = GetTime() + fmin(delay, HISTORY_RETRY_MAX_DELAY);
+}
+
+// Replies are mostly to recent messages, so the search starts from the newest
 static Msg *find_msg(std::int64_t msg_id)
 {
-    Msg *begin = &chat_messages[chat_message_count-1];
-    Msg *end = &chat_messages[-1];
-    for (Msg *it = begin; it != end; it--) {
-        if (it->id == msg_id) {
-            return it;
+    for (size_t i = chat_msgs.len; i-- > 0;) {
+        Msg *msg = msg_at(i);
+        if (msg->id == msg_id) {
+            return msg;
         }
     }
 
     return nullptr;
 }
 
+// The preview is cut at a codepoint boundary. The reply goes right above the text
+static void set_reply_to(Msg *msg, Msg *reply_to)
+{
+    const std::string *reply_text = reply_to->text;
+    size_t reply_text_len = reply_text->size();
+    if (reply_text_len > MSG_REPLY_PREVIEW_MAX_LEN) {
+        reply_text_len = MSG_REPLY_PREVIEW_MAX_LEN;
+        while (reply_text_len > 0 && ((*reply_text)[reply_text_len] & 0xc0) == 0x80) reply_text_len -= 1;
+    }
+
+    msg->has_reply_to = true;
+    msg->reply_to.id = reply_to->id;
+    msg->reply_to.text = (char *) malloc(reply_text_len);
+    if (reply_text_len > 0 && msg->reply_to.text == nullptr) {
+        fprintf(stderr, "ERROR: Could not allocate reply text: no memory\n");
+        exit(1);
+    }
+    memcpy(msg->reply_to.text, reply_text->data(), reply_text_len);
+    msg->reply_to.text_len = reply_text_len;
+    msg->reply_to.sender_name = reply_to->sender_name;
+    msg->reply_to.is_mine = reply_to->is_mine;
+
+    assert(msg->widget_count > 0 && msg->widgets[msg->widget_count-1].tag == WidgetTag::TEXT);
+    msg->widgets[msg->widget_count] = msg->widgets[msg->widget_count-1];
+    msg->widgets[msg->widget_count-1] = { WidgetTag::REPLY, {} };
+    msg->widget_count += 1;
+}
+
+static void add_pending_reply(Msg *msg)
+{
+    if (chat_pending_reply_count >= chat_pending_reply_cap) {
+        chat_pending_reply_cap = chat_pending_reply_cap == 0 ? 16 : 2*chat_pending_reply_cap;
+        chat_pending_replies = (Msg **) realloc(chat_pending_replies, chat_pending_reply_cap*sizeof(Msg *));
+        if (chat_pending_replies == nullptr) {
+            fprintf(stderr, "ERROR: Could not grow pending replies: no memory\n");
+            exit(1);
+        }
+    }
+    chat_pending_replies[chat_pending_reply_count++] = msg;
+}
+
+// The first 'new_count' messages came with a history page. Replies to a
+// message at least as new as the oldest one are resolved now or never: if
+// it is not in the page, it was deleted. Replies to older messages wait
+static void resolve_pending_replies(size_t new_count)
+{
+    std::int64_t oldest_id = msg_at(0)->id;
+    for (size_t i = 0; i < chat_pending_reply_count;) {
+        Msg *msg = chat_pending_replies[i];
+        if (msg->pending_reply_to_id < oldest_id) {
+            i += 1;
+            continue;
+        }
+
+        Msg *reply_to = nullptr;
+        for (size_t j = 0; j < new_count && reply_to == nullptr; j++) {
+            if (msg_at(j)->id == msg->pending_reply_to_id) reply_to = msg_at(j);
+        }
+        if (reply_to == nullptr) {
+            std::wcout << "Could not reply to " << msg->pending_reply_to_id << ": not found\n";
+        } else {
+            // Same as a resize for a laid out message
+            size_t idx = msg_idx(msg);
+            size_t memory = msg_memory(msg);
+            set_reply_to(msg, reply_to);
+            chat_memory_used += msg_memory(msg) - memory;
+            if (msg->layout == MSG_LAYOUT_ESTIMATED) {
+                estimate_msg_size(msg);
+            } else if (msg->layout == MSG_LAYOUT_EXACT) {
+                msg->layout = MSG_LAYOUT_STALE;
+                add_pending_layout(idx, 1);
+            }
+            store_mark_height_dirty(idx);
+        }
+        msg->pending_reply_to_id = 0;
+        chat_pending_replies[i] = chat_pending_replies[--chat_pending_reply_count];
+    }
+}
+
+static void unload_msg(Msg *msg)
+{
+    if (msg->pending_reply_to_id != 0) {
+        size_t i = 0;
+        while (chat_pending_replies[i] != msg) i++;
+        chat_pending_replies[i] = chat_pending_replies[--chat_pending_reply_count];
+    }
+    delete msg->text;
+    if (msg->has_reply_to) free(msg->reply_to.text);
+    msg->text_lines.unload();
+}
+
+// Memory taken by the message and its lines with their capacity. Measured the
+// same way when the message is added, laid out and dropped. Message lines
+// have no 'xs'
+static size_t msg_memory(Msg *msg)
+{
+    common::Utf8Lines *lines = &msg->text_lines;
+    size_t result = sizeof(Msg) + sizeof(std::string) + msg->text->capacity();
+    if (msg->has_reply_to) result += msg->reply_to.text_len;
+    result += lines->cap*sizeof(common::Utf8Line);
+    result += lines->emoji_run_cap*sizeof(common::EmojiRun);
+    result += lines->word_cap*sizeof(common::Word);
+    return result;
+}
+
+static Msg *msg_at(size_t idx)
+{
+    assert(idx < chat_msgs.len);
+    size_t pos = chat_msgs.first + idx;
+    return &store_chunk(pos/MSG_STORE_CHUNK_SIZE)->msgs[pos%MSG_STORE_CHUNK_SIZE];
+}
+
+// Chunks never move, so the chunk of a message is found by its address
+static size_t msg_idx(Msg *msg)
+{
+    for (size_t i = 0; i < chat_msgs.chunk_count; i++) {
+        MsgChunk *chunk = store_chunk(i);
+        if (msg >= chunk->msgs && msg < &chunk->msgs[MSG_STORE_CHUNK_SIZE]) {
+            return i*MSG_STORE_CHUNK_SIZE + (msg - chunk->msgs) - chat_msgs.first;
+        }
+    }
+
+    assert(false && "Message is not in the store");
+    return SIZE_MAX;
+}
+
+// Chunk 0 has the oldest message
+static MsgChunk *store_chunk(size_t chunk_idx)
+{
+    return chat_msgs.chunks[(chat_msgs.first_chunk + chunk_idx) & (chat_msgs.chunk_cap - 1)];
+}
+
+// Returns a zeroed message at the front or the back of the store
+static Msg *store_push(bool at_front)
+{
+    MsgStore *store = &chat_msgs;
+    bool needs_chunk = at_front ?
+        store->first == 0 :
+        store->first + store->len == store->chunk_count*MSG_STORE_CHUNK_SIZE;
+    if (needs_chunk) {
+        if (store->chunk_count == store->chunk_cap) {
+            size_t new_cap = store->chunk_cap == 0 ? MSG_STORE_INIT_CHUNK_CAPACITY : 2*store->chunk_cap;
+            MsgChunk **new_chunks = (MsgChunk **) malloc(new_cap*sizeof(MsgChunk *));
+            float *new_chunk_tops = (float *) realloc(store->chunk_tops, (new_cap + 1)*sizeof(float));
+            if (new_chunks == nullptr || new_chunk_tops == nullptr) {
+                fprintf(stderr, "ERROR: Could not allocate message store: no memory\n");
+                exit(1);
+            }
+            for (size_t i = 0; i < store->chunk_count; i++) new_chunks[i] = store_chunk(i);
+            free(store->chunks);
+            store->chunks = new_chunks;
+            store->chunk_tops = new_chunk_tops;
+            store->chunk_cap = new_cap;
+            store->first_chunk = 0;
+        }
+
+        MsgChunk *chunk = (MsgChunk *) malloc(sizeof(MsgChunk));
+        if (chunk == nullptr) {
+            fprintf(stderr, "ERROR: Could not allocate message store: no memory\n");
+            exit(1);
+        }
+        chunk->pending_layout_count = 0;
+        if (at_front) {
+            store->first_chunk = (store->first_chunk - 1) & (store->chunk_cap - 1);
+            store->chunks[store->first_chunk] = chunk;
+            store->first += MSG_STORE_CHUNK_SIZE;
+        } else {
+            store->chunks[(store->first_chunk + store->chunk_count) & (store->chunk_cap - 1)] = chunk;
+        }
+        store->chunk_count += 1;
+    }
+
+    if (at_front) store->first -= 1;
+    store->len += 1;
+    if (at_front) chat_scroll_anchor += 1;
+    size_t idx = at_front ? 0 : store->len - 1;
+    *msg_at(idx) = {};
+    store_mark_height_dirty(idx);
+    return msg_at(idx);
+}
+
+// Drops the message at the front or the back, it has to be unloaded before.
+// A chunk is freed when it gets empty
+static void store_pop(bool at_front)
+{
+    MsgStore *store = &chat_msgs;
+    assert(store->len > 0);
+    store_mark_height_dirty(at_front ? 0 : store->len - 1);
+    store->len -= 1;
+    if (at_front && chat_scroll_anchor > 0) chat_scroll_anchor -= 1;
+    if (chat_scroll_anchor >= store->len) chat_scroll_anchor = store->len == 0 ? 0 : store->len - 1;
+    if (at_front) {
+        store->first += 1;
+        if (store->first == MSG_STORE_CHUNK_SIZE) {
+            free(store_chunk(0));
+            store->first_chunk = (store->first_chunk + 1) & (store->chunk_cap - 1);
+            store->chunk_count -= 1;
+            store->first = 0;
+        }
+    } else if (store->first + store->len == (store->chunk_count - 1)*MSG_STORE_CHUNK_SIZE) {
+        free(store_chunk(store->chunk_count - 1));
+        store->chunk_count -= 1;
+    }
+}
+
+// Unloads every message, the ring of chunks is kept
+static void store_clear()
+{
+    MsgStore *store = &chat_msgs;
+    for (size_t i = 0; i < store->len; i++) unload_msg(msg_at(i));
+    for (size_t i = 0; i < store->chunk_count; i++) free(store_chunk(i));
+    store->first_chunk = 0;
+    store->chunk_count = 0;
+    store->first = 0;
+    store->len = 0;
+    store->are_tops_dirty = true;
+    chat_scroll = 0;
+    chat_scroll_target = 0;
+    chat_scroll_anchor = 0;
+}
+
+// Has to be called when a message is added, removed or changes its height
+static void store_mark_height_dirty(size_t idx)
+{
+    size_t pos = chat_msgs.first + idx;
+    store_chunk(pos/MSG_STORE_CHUNK_SIZE)->are_tops_dirty = true;
+    chat_msgs.are_tops_dirty = true;
+}
+
+// Only dirty chunks sum their messages, the chunk tops are summed again
+// whole. That is a few hundred additions for ten thousand messages
+static void store_update_tops()
+{
+    MsgStore *store = &chat_msgs;
+    if (!store->are_tops_dirty) return;
+
+    if (store->chunk_tops == nullptr) {
+        store->chunk_tops = (float *) malloc(sizeof(float));
+        if (store->chunk_tops == nullptr) {
+            fprintf(stderr, "ERROR: Could not allocate message store: no memory\n");
+            exit(1);
+        }
+    }
+
+    store->chunk_tops[0] = 0;
+    for (size_t i = 0; i < store->chunk_count; i++) {
+        MsgChunk *chunk = store_chunk(i);
+        if (chunk->are_tops_dirty) {
+            size_t begin = i == 0 ? store->first : 0;
+            size_t end = store->first + store->len - i*MSG_STORE_CHUNK_SIZE;
+            if (end > MSG_STORE_CHUNK_SIZE) end = MSG_STORE_CHUNK_SIZE;
+            chunk->tops[0] = 0;
+            for (size_t j = 0; j < MSG_STORE_CHUNK_SIZE; j++) {
+                float height = j >= begin && j < end ? chunk->msgs[j].size.y + MSG_DISTANCE : 0;
+                chunk->tops[j + 1] = chunk->tops[j] + height;
+            }
+            chunk->are_tops_dirty = false;
+        }
+        store->chunk_tops[i + 1] = store->chunk_tops[i] + chunk->tops[MSG_STORE_CHUNK_SIZE];
+    }
+    store->are_tops_dirty = false;
+}
+
+// Counted from the top of the oldest message. Tops have to be up to date
+static float msg_top(size_t idx)
+{
+    assert(!chat_msgs.are_tops_dirty);
+    size_t pos = chat_msgs.first + idx;
+    return chat_msgs.chunk_tops[pos/MSG_STORE_CHUNK_SIZE] +
+        store_chunk(pos/MSG_STORE_CHUNK_SIZE)->tops[pos%MSG_STORE_CHUNK_SIZE];
+}
+
+// With 'MSG_DISTANCE' after every message
+static float msg_list_height()
+{
+    assert(!chat_msgs.are_tops_dirty);
+    return chat_msgs.len == 0 ? 0 : chat_msgs.chunk_tops[chat_msgs.chunk_count];
+}
+
+// Returns the message that 'y' (counted like 'msg_top') falls on, clamped
+// to the first and the last message. Two binary searches: over the chunk
+// tops, then over the tops inside the chunk
+static size_t find_msg_at(float y)
+{
+    assert(!chat_msgs.are_tops_dirty && chat_msgs.len > 0);
+    size_t lo = 0;
+    size_t hi = chat_msgs.chunk_count - 1;
+    while (lo < hi) {
+        size_t mid = (lo + hi + 1)/2;
+        if (chat_msgs.chunk_tops[mid] <= y) lo = mid;
+        else hi = mid - 1;
+    }
+
+    MsgChunk *chunk = store_chunk(lo);
+    float chunk_y = y - chat_msgs.chunk_tops[lo];
+    size_t slot_lo = 0;
+    size_t slot_hi = MSG_STORE_CHUNK_SIZE - 1;
+    while (slot_lo < slot_hi) {
+        size_t mid = (slot_lo + slot_hi + 1)/2;
+        if (chunk->tops[mid] <= chunk_y) slot_lo = mid;
+        else slot_hi = mid - 1;
+    }
+
+    size_t pos = lo*MSG_STORE_CHUNK_SIZE + slot_lo;
+    if (pos < chat_msgs.first) return 0;
+    if (pos - chat_msgs.first >= chat_msgs.len) return chat_msgs.len - 1;
+    return pos - chat_msgs.first;
+}
+
+// Without measuring anything: glyphs are taken as half the font size wide
+// and every byte of the text as a glyph
+static void estimate_msg_size(Msg *msg)
+{
+    float text_width = 0.5f*common::font_size(MSG_TEXT_FONT_ID)*msg->text->size();
+    float line_count = fmaxf(1, ceilf(text_width/max_msg_widget_width));
+    msg->size = { fminf(text_width, max_msg_widget_width), line_count*common::font_size(MSG_TEXT_FONT_ID) };
+    if (!msg->is_mine) msg->size.y += common::font_size(MSG_SENDER_NAME_FONT_ID);
+    if (msg->has_reply_to) {
+        msg->size.y += 2*MSG_REPLY_PADDING +
+            common::font_size(MSG_REPLY_SENDER_NAME_FONT_ID) +
+            common::font_size(MSG_REPLY_TEXT_FONT_ID);
+    }
+    msg->size.y += BoxModel::MSG_TP + BoxModel::MSG_BP;
+    msg->size.x += BoxModel::MSG_LP + BoxModel::MSG_RP;
+}
+
+static void layout_msg(size_t idx)
+{
+    Msg *msg = msg_at(idx);
+    size_t memory = msg_memory(msg);
+
+    // Text is measured once, layouts for any width only wrap the words
+    if (msg->layout == MSG_LAYOUT_ESTIMATED) {
+        msg->text_lines.analyse(MSG_TEXT_FONT_ID, msg->text->data(), msg->text->size());
+    }
+    if (msg->layout != MSG_LAYOUT_EXACT) add_pending_layout(idx, -1);
+    msg->layout = MSG_LAYOUT_EXACT;
+
+    msg->size = {};
+    for (size_t i = 0; i < msg->widget_count; i++) {
+        Vector2 size = widget_vtable[msg->widgets[i].tag].size_fn(msg);
+        msg->widgets[i].size = size;
+        msg->size.y += size.y;
+        if (size.x > msg->size.x) msg->size.x = size.x;
+    }
+    msg->size.y += BoxModel::MSG_TP + BoxModel::MSG_BP;
+    msg->size.x += BoxModel::MSG_LP + BoxModel::MSG_RP;
+    chat_memory_used += msg_memory(msg) - memory;
+    store_mark_height_dirty(idx);
+}
+
+// Visible messages are laid out whatever it takes, the rest while the frame
+// budget lasts. The view is anchored at the newest message or, scrolled up,
+// at a message in it (see 'update_msg_tops'), so messages out of the view
+// can change their height without moving it
+static void layout_pending_msgs()
+{
+    if (chat_pending_layout_count == 0) return;
+
+    // Exact heights can bring more messages into the view, so it is found
+    // again until every visible message is laid out
+    size_t first_visible = 0;
+    size_t end = 0;
+    for (bool is_done = false; !is_done;) {
+        update_msg_tops();
+        first_visible = first_visible_msg();
+        end = last_visible_msg() + 1;
+        is_done = true;
+        for (size_t i = first_visible; i < end; i++) {
+            if (msg_at(i)->layout == MSG_LAYOUT_EXACT) continue;
+            layout_msg(i);
+            is_done = false;
+        }
+    }
+
+    // Older messages go first, they are the ones scrolled to more often
+    double deadline = GetTime() + CHAT_LAYOUT_TIME_PER_FRAME;
+    size_t layout_count = 0;
+    bool is_over_budget = false;
+    for (size_t i = first_visible; !is_over_budget && (i = find_pending_msg(i, true)) != SIZE_MAX;) {
+        is_over_budget = layout_count++ % LAYOUTS_PER_CLOCK_CHECK == 0 && GetTime() >= deadline;
+        if (!is_over_budget) layout_msg(i);
+    }
+    for (size_t i = end; !is_over_budget && (i = find_pending_msg(i, false)) != SIZE_MAX; i++) {
+        is_over_budget = layout_count++ % LAYOUTS_PER_CLOCK_CHECK == 0 && GetTime() >= deadline;
+        if (!is_over_budget) layout_msg(i);
+    }
+    update_msg_tops();
+}
+
+static void add_pending_layout(size_t idx, int delta)
+{
+    size_t pos = chat_msgs.first + idx;
+    store_chunk(pos/MSG_STORE_CHUNK_SIZE)->pending_layout_count += delta;
+    chat_pending_layout_count += delta;
+}
+
+// Returns the closest message that is not laid out before 'from' or at and
+// after it, or 'SIZE_MAX'. Chunks without such messages are skipped whole
+static size_t find_pending_msg(size_t from, bool is_older)
+{
+    size_t i = from;
+    while (is_older ? i > 0 : i < chat_msgs.len) {
+        size_t idx = is_older ? i - 1 : i;
+        size_t pos = chat_msgs.first + idx;
+        size_t slot = pos%MSG_STORE_CHUNK_SIZE;
+        if (store_chunk(pos/MSG_STORE_CHUNK_SIZE)->pending_layout_count == 0) {
+            if (is_older) i = idx > slot ? idx - slot : 0;
+            else i = idx + MSG_STORE_CHUNK_SIZE - slot;
+            continue;
+        }
+
+        if (msg_at(idx)->layout != MSG_LAYOUT_EXACT) return idx;
+        i = is_older ? i - 1 : i + 1;
+    }
+
+    return SIZE_MAX;
+}
+
+// Oldest message that reaches into the view
+static size_t first_visible_msg()
+{
+    if (chat_msgs.len == 0) return 0;
+    float hidden_height = msg_list_height() - chat_scroll - chat_view_bottom();
+    return hidden_height <= 0 ? 0 : find_msg_at(hidden_height);
+}
+
+// Newest message that reaches into the view, there has to be one message at least
+static size_t last_visible_msg()
+{
+    return find_msg_at(msg_list_height() - chat_scroll);
+}
+
+// While the view is scrolled up it stays on its messages when heights below
+// it change or new messages come, the scroll is found again from the anchor.
+// On the way to the bottom nothing is anchored, the newest message is followed
+static void update_msg_tops()
+{
+    store_update_tops();
+    if (chat_scroll_target == 0 || chat_msgs.len == 0) return;
+
+    float scroll = msg_list_height() - msg_top(chat_scroll_anchor) - chat_scroll_anchor_y;
+    chat_scroll_target += scroll - chat_scroll;
+    chat_scroll = scroll;
+}
+
+// The scroll eases to its target in fixed steps, so it moves the same way
+// at any frame rate. Every position is found with the prefix sums of heights
+static void update_scroll()
+{
+    float view_height = chat_view_bottom();
+    if (GetMouseWheelMove() != 0) chat_scroll_target += GetMouseWheelMove()*CHAT_SCROLL_SPEED;
+    if (KEYMAP_SCROLL_UP)   chat_scroll_target += 0.9f*view_height;
+    if (KEYMAP_SCROLL_DOWN) chat_scroll_target -= 0.9f*view_height;
+
+    update_msg_tops();
+    float max_scroll = fmaxf(0, msg_list_height() - view_height);
+    chat_scroll_target = fminf(fmaxf(chat_scroll_target, 0), max_scroll);
+
+    // A long frame is not caught up with, the scroll jumps instead
+    chat_scroll_time = fminf(chat_scroll_time + GetFrameTime(), CHAT_SCROLL_MAX_STEPS*CHAT_SCROLL_STEP);
+    for (; chat_scroll_time >= CHAT_SCROLL_STEP; chat_scroll_time -= CHAT_SCROLL_STEP) {
+        chat_scroll += (chat_scroll_target - chat_scroll)*CHAT_SCROLL_EASING;
+    }
+    if (fabsf(chat_scroll_target - chat_scroll) < 0.5f) chat_scroll = chat_scroll_target;
+    chat_scroll = fminf(fmaxf(chat_scroll, 0), max_scroll);
+
+    if (chat_msgs.len > 0) {
+        float view_bottom = msg_list_height() - chat_scroll;
+        chat_scroll_anchor = find_msg_at(view_bottom);
+        chat_scroll_anchor_y = view_bottom - msg_top(chat_scroll_anchor);
+    }
+}
+
+// Old sizes are kept as estimates until the messages are laid out again
+static void resize_chat_view(float width)
+{
+    chat_view_width = width;
+    max_msg_widget_width = floor(width - BoxModel::MSG_LM - BoxModel::MSG_LP - BoxModel::MSG_RP - BoxModel::MSG_RM);
+    ted_max_line_width = floor(width - BoxModel::TED_LM - BoxModel::TED_LP - BoxModel::TED_RP - BoxModel::TED_RM);
+    mark_msgs_stale();
+
+    wchar_t *cursor_ptr = &ted_lines.items[ted_cursor_pos.row].text[ted_cursor_pos.col];
+    ted_lines.recalc(TED_FONT_ID, ted_buffer, ted_buffer_len, ted_max_line_width);
+    ted_move_cursor_to_ptr(cursor_ptr);
+}
+
+// Laid out messages are laid out again, the text is not measured again
+static void mark_msgs_stale()
+{
+    for (size_t i = 0; i < chat_msgs.len; i++) {
+        Msg *msg = msg_at(i);
+        if (msg->layout != MSG_LAYOUT_EXACT) continue;
+        msg->layout = MSG_LAYOUT_STALE;
+        add_pending_layout(i, 1);
+    }
+}
+
+// Top of the text editor, the newest message is right above it
+static float chat_view_bottom()
+{
+    return GetScreenHeight() - (ted_lines.len*common::font_size(TED_FONT_ID) +
+            BoxModel::TED_BM + BoxModel::TED_BP +
+            BoxModel::TED_TP + BoxModel::TED_TM);
+}
+
 // WIDGET FUNCTIONS IMPLS ///////////////
 
 static Vector2 widget_sender_name_size_fn(Msg *msg_data)
 {
-    float width = common::measure_wtext(
+    std::wstring_view sender_name = tgclient::name(msg_data->sender_name);
+    float width = common::measure_text_in_width(
             MSG_SENDER_NAME_FONT_ID,
-            &msg_data->sender_name[0],
-            msg_data->sender_name.length());
+            sender_name.data(),
+            sender_name.length(),
+            max_msg_widget_width);
 
-    return { width > max_msg_widget_width ? max_msg_widget_width : width, common::font_size(MSG_SENDER_NAME_FONT_ID) };
+    return { width, common::font_size(MSG_SENDER_NAME_FONT_ID) };
 }
 
 static void widget_sender_name_render_fn(Msg *msg_data, Vector2 pos, float)
 {
+    std::wstring_view sender_name = tgclient::name(msg_data->sender_name);
     common::draw_text_in_width(
             MSG_SENDER_NAME_FONT_ID,
-            pos, &msg_data->sender_name[0], msg_data->sender_name.length(),
+            pos, sender_name.data(), sender_name.length(),
             msg_color_palette[msg_data->is_mine].sender_name_color, max_msg_widget_width);
 }
 
 static Vector2 widget_text_size_fn(Msg *msg_data)
 {
-    msg_data->text_lines.recalc(
-            MSG_TEXT_FONT_ID,
-            msg_data->text.data, msg_data->text.len,
-            max_msg_widget_width);
+    msg_data->text_lines.wrap(MSG_TEXT_FONT_ID, max_msg_widget_width);
 
-    return { msg_data->text_lines.max_line_width(MSG_TEXT_FONT_ID), (float)msg_data->text_lines.len*common::font_size(MSG_TEXT_FONT_ID) };
+    return { msg_data->text_lines.max_line_width(), (float)msg_data->text_lines.len*common::font_size(MSG_TEXT_FONT_ID) };
 }
 
 static void widget_text_render_fn(Msg *msg_data, Vector2 pos, float)
 {
     common::draw_lines(
-            MSG_TEXT_FONT_ID, pos, msg_data->text_lines,
+            MSG_TEXT_FONT_ID, pos, &msg_data->text_lines,
             msg_color_palette[msg_data->is_mine].fg_color);
 }
 
 static Vector2 widget_reply_size_fn(Msg *msg_data)
 {
-    float reply_text_width = common::measure_wtext(
-            MSG_TEXT_FONT_ID,
-            msg_data->reply_to.text.data,
-            msg_data->reply_to.text.len);
+    // Only one line of the reply is drawn, so the rest is not measured
+    float max_reply_content_width = max_msg_widget_width - 2*MSG_REPLY_PADDING;
+    float reply_text_width = common::measure_text_in_width(
+            MSG_REPLY_TEXT_FONT_ID,
+            msg_data->reply_to.text,
+            msg_data->reply_to.text_len,
+            max_reply_content_width);
 
-    float reply_sender_name_width = common::measure_wtext(
-            MSG_SENDER_NAME_FONT_ID,
-            &msg_data->reply_to.sender_name[0],
-            msg_data->reply_to.sender_name.length());
+    std::wstring_view reply_sender_name = tgclient::name(msg_data->reply_to.sender_name);
+    float reply_sender_name_width = common::measure_text_in_width(
+            MSG_REPLY_SENDER_NAME_FONT_ID,
+            reply_sender_name.data(),
+            reply_sender_name.length(),
+            max_reply_content_width);
 
     float width = 
         (reply_text_width > reply_sender_name_width ?
@@ -900,10 +1519,10 @@ static Vector2 widget_reply_size_fn(Msg *msg_data)
          reply_sender_name_width) + 2*MSG_REPLY_PADDING;
 
     return {
-        width > max_msg_widget_width ? max_msg_widget_width : width,
+        width,
               2*MSG_REPLY_PADDING +
-                  common::font_size(MSG_SENDER_NAME_FONT_ID) +
-                  common::font_size(MSG_TEXT_FONT_ID) };
+                  common::font_size(MSG_REPLY_SENDER_NAME_FONT_ID) +
+                  common::font_size(MSG_REPLY_TEXT_FONT_ID) };
 }
 
 static void widget_reply_render_fn(Msg *msg_data, Vector2 pos, float width)
@@ -931,18 +1550,19 @@ static void widget_reply_render_fn(Msg *msg_data, Vector2 pos, float width)
     pos.x += MSG_REPLY_PADDING;
     pos.y += MSG_REPLY_PADDING;
 
+    std::wstring_view reply_sender_name = tgclient::name(msg_data->reply_to.sender_name);
     common::draw_text_in_width(
             MSG_REPLY_SENDER_NAME_FONT_ID,
-            pos, &msg_data->reply_to.sender_name[0],
-            msg_data->reply_to.sender_name.length(),
+            pos, reply_sender_name.data(),
+            reply_sender_name.length(),
             reply_sender_name_color, max_reply_content_width);
 
     pos.y += common::font_size(MSG_REPLY_SENDER_NAME_FONT_ID);
 
     common::draw_text_in_width(
             MSG_REPLY_TEXT_FONT_ID,
-            pos, msg_data->reply_to.text.data,
-            msg_data->reply_to.text.len,
+            pos, msg_data->reply_to.text,
+            msg_data->reply_to.text_len,
             msg_color_palette[msg_data->is_mine].fg_color, max_reply_content_width);
 }
 
@@ -960,7 +1580,7 @@ static void cmd_list_chats()
         +[](td_api::object_ptr<td_api::chats> c){
             std::wstring msg;
             for (auto chat_id : c->chat_ids_) {
-                msg.append(tgclient::chat_title(chat_id));
+                msg.append(tgclient::name(tgclient::chat_title(chat_id)));
                 msg.push_back(' ');
                 msg.append(std::to_wstring(chat_id));
                 msg.push_back('\n');
@@ -975,9 +1595,16 @@ static void cmd_select_chat()
     assert(ted_arg_count > 1);
     chat_id = to_int64_t(ted_args[1]);
 
+    store_clear();
+    chat_memory_used = 0;
+    chat_pending_layout_count = 0;
+    chat_selection_offset = 0;
+    history_is_complete = false;
+    history_open_request_count = 0;
+    history_retry_count = 0;
+    history_error_count = 0;
+    history_retry_time = 0;
+
     tgclient::request(td_api::make_object<td_api::openChat>(chat_id));
-    tgclient::request(
-        td_api::make_object<td_api::getChatHistory>(
-            chat_id, 0, -10, MSG_COUNT_TO_LOAD_WHEN_OPEN_CHAT, false),
-        load_msgs);
+    fetch_history();
 }
@@ -1,48 +1,401 @@
 #include <cstdlib>
+#include <cstddef>
 #include <cstdio>
 #include <cstring>
 #include <cassert>
 #include <cwchar>
+#include <cstdint>
 #include <dirent.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#include <rlgl.h>
+// raylib builds its copy of stb_truetype as static, so glyphs are
+// rasterised with our own
+#define STBTT_STATIC
+#define STB_TRUETYPE_IMPLEMENTATION
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-function"
+#pragma GCC diagnostic ignored "-Wunused-parameter"
+#pragma GCC diagnostic ignored "-Wmissing-field-initializers"
+#include <external/stb_truetype.h>
+#pragma GCC diagnostic pop
 
 #include "common.h"
 #include "config.h"
+#include "line_break.h"
 
 #define EMOJI_DIR_PATH "resources/emoji"
+#define EMOJI_CACHE_FILE_NAME    "emoji.cache" // Next to the executable, wherever it is launched from
+#define EMOJI_CACHE_PATH_CAPACITY 4096
+#define EMOJI_CACHE_MAGIC        "STGEMOJI"
+#define EMOJI_CACHE_VERSION      1
 // TODO: Emoji size should be adapted to font size
 #define EMOJI_SIZE     28.0f
 #define EMOJI_COUNT    1252
 
-struct Emoji {
-    wchar_t code;
+#define UNICODE_CODEPOINT_COUNT 0x110000
+#define BMP_CODEPOINT_COUNT     0x10000
+#define EMOJI_PAGE_SIZE         256
+#define EMOJI_PAGE_CAPACITY     32
+#define GLYPH_PAGE_SIZE         256
+#define EMOJI_ATLAS_COLUMNS     64
+#define EMOJI_TRIE_CAPACITY     (4*EMOJI_COUNT)
+
+#define GLYPH_ATLAS_PAGE_SIZE      1024
+#define GLYPH_ATLAS_PAGE_CAPACITY  64
+#define GLYPH_PADDING              2
+#define GLYPH_SDF_PADDING          4    // As raylib's 'FONT_SDF_CHAR_PADDING'
+#define GLYPH_SDF_ON_EDGE_VALUE    128
+#define GLYPH_SDF_PIXEL_DIST_SCALE 64.0f
+
+#define LINES_INIT_CAPACITY      1 // Most messages are one line
+#define EMOJI_RUNS_INIT_CAPACITY 8
+#define ARENA_BLOCK_SIZE         (64*1024)
+// Widths that differ by rounding only compare as equal when lines are wrapped.
+// 'wrap_text' sums advances and 'Lines::wrap' subtracts pen positions
+#define WRAP_EPSILON             0.01f
+#define TEXT_BATCH_CAPACITY      256 // Uploaded batches, the least recently drawn ones are dropped over it
+#define TEXT_DRAWS_INIT_CAPACITY 64
+
+// All emoji of one size packed into a single texture. Emoji with slot 'i'
+// occupies cell 'i' counting from the top left corner row by row
+struct EmojiAtlas {
     Texture2D texture;
+    int cell_size;
+};
+
+// Layout of 'g_emoji_cache_path':
+//   header
+//   int32_t  sizes[size_count]
+//   uint32_t codes[emoji_count] (in slot order)
+//   RGBA pixels of the atlas of every size one after another
+struct EmojiCacheHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t emoji_count;
+    uint32_t size_count;
+    uint32_t atlas_columns;
+    int64_t dir_mtime;
+    uint64_t dir_hash; // Hash of the file names, sizes and modification times
+};
+
+enum EmojiState {
+    EMOJI_STATE_UNLOADED,
+    EMOJI_STATE_REQUESTED, // Waits in 'g_emoji_load_queue' until it is packed
+    EMOJI_STATE_LOADED,
+};
+
+// Values indexed by codepoint. The BMP is a flat array, codepoints beyond
+// it live in pages that are allocated on the first write to them
+template<typename T>
+struct CodepointTable {
+    T bmp[BMP_CODEPOINT_COUNT];
+    T *astral_pages[(UNICODE_CODEPOINT_COUNT-BMP_CODEPOINT_COUNT)/GLYPH_PAGE_SIZE];
+    T fallback; // Value of codepoints that were never set
+
+    void init(T fallback_value)
+    {
+        fallback = fallback_value;
+        for (size_t i = 0; i < BMP_CODEPOINT_COUNT; i++) bmp[i] = fallback;
+    }
+
+    T get(wchar_t codepoint)
+    {
+        uint32_t cp = codepoint;
+        if (cp < BMP_CODEPOINT_COUNT) return bmp[cp];
+        if (cp >= UNICODE_CODEPOINT_COUNT) return fallback;
+
+        T *page = astral_pages[(cp-BMP_CODEPOINT_COUNT)/GLYPH_PAGE_SIZE];
+        return page == nullptr ? fallback : page[cp%GLYPH_PAGE_SIZE];
+    }
+
+    void set(wchar_t codepoint, T value)
+    {
+        uint32_t cp = codepoint;
+        if (cp < BMP_CODEPOINT_COUNT) {
+            bmp[cp] = value;
+            return;
+        }
+
+        assert(cp < UNICODE_CODEPOINT_COUNT);
+        T **page = &astral_pages[(cp-BMP_CODEPOINT_COUNT)/GLYPH_PAGE_SIZE];
+        if (*page == nullptr) {
+            *page = (T *) malloc(GLYPH_PAGE_SIZE * sizeof(T));
+            if (*page == nullptr) {
+                fprintf(stderr, "ERROR: Could not allocate codepoint page: no memory\n");
+                exit(1);
+            }
+            for (size_t i = 0; i < GLYPH_PAGE_SIZE; i++) (*page)[i] = fallback;
+        }
+
+        (*page)[cp%GLYPH_PAGE_SIZE] = value;
+    }
+};
+
+struct Glyph {
+    Rectangle rec;  // Bitmap with padding in the atlas page
+    size_t page;
+    float offset_x; // From the pen position to the bitmap without padding
+    float offset_y;
+    float advance;
+};
+
+// Glyphs of a font are rasterised the first time they are measured or
+// drawn and packed into atlas pages row by row. A page is never resized:
+// when the last page is full a new one is added. In 'SDF_FONTS' mode glyphs
+// are distance fields of 'SDF_FONT_BASE_SIZE' and one atlas serves every
+// size of the typeface, unless the SDF shader could not be compiled
+struct GlyphAtlas {
+    const char *path;
+    unsigned char *file_data; // Kept alive for 'font_info'
+    int file_size;
+    stbtt_fontinfo font_info;
+    float font_scale; // From font units to 'font_size' pixels
+    int ascent;       // In 'font_size' pixels
+    int font_size;
+    int font_type;
+    Texture2D pages[GLYPH_ATLAS_PAGE_CAPACITY];
+    size_t page_count;
+    int pen_x;      // Packing position in the last page
+    int pen_y;
+    int row_height;
+    Glyph *glyphs;
+    size_t glyph_count;
+    size_t glyph_cap;
+    CodepointTable<uint32_t> glyph_idxs; // 'idx+1' in 'glyphs', 0 means "not rasterised yet"
 };
 
 struct FontData {
-    Font font;
+    GlyphAtlas *atlas;
+    float size;
+    float scale; // From the atlas glyphs to this size
     EmojiSize emoji_size;
 };
 
+// Glyph quads of one atlas page uploaded as a mesh
+struct TextBatchPart {
+    size_t page;
+    Mesh mesh;
+};
+
+// Valid batches are in a list from the most recently drawn one
+struct common::TextBatch {
+    bool is_valid;
+    FontId font_id;
+    TextBatchPart *parts;
+    size_t part_count;
+    TextBatch *prev;
+    TextBatch *next;
+    uint64_t drawn_frame;
+};
+
+// Mesh queued by 'draw_lines' until 'flush_text'
+struct TextDraw {
+    Mesh mesh;
+    Texture2D texture;
+    Vector2 pos;
+    Color color;
+};
+
+// Emoji sequences from the file names ('1f468-200d-1f469.png' is a family).
+// Roots are found through the emoji page table, children of a node are a
+// list of siblings. U+FE0F is left out of the keys, so it is optional in text
+struct EmojiTrieNode {
+    wchar_t codepoint;
+    int slot;              // -1 if no emoji ends here
+    uint16_t first_child;  // 0 means none
+    uint16_t next_sibling;
+};
+
+// Piece of text drawn as one glyph or one emoji
+struct TextUnit {
+    size_t len;        // In code units
+    int emoji_slot;    // -1 for a glyph
+    wchar_t codepoint; // The first one
+};
+
+// Header of an arena block. The memory follows it
+struct alignas(std::max_align_t) common::ArenaBlock {
+    ArenaBlock *next;
+    size_t size;
+    size_t used;
+};
+
+// Old layout that 'Lines::rewrap' tries to rejoin
+template <typename Char>
+struct WrapResync {
+    common::BasicLines<Char> *old_lines;
+    size_t old_row;      // Old lines before it are not compared
+    size_t min_offset;   // End of the edit. Lines starting before it differ
+    ptrdiff_t delta;     // From old offsets to new ones
+    size_t xs_end;       // Set on resync: 'xs' before it are recalculated
+    float x;             // Set on resync: pen position at 'xs_end'
+};
+
+enum DrawPass {
+    DRAW_PASS_GLYPHS,
+    DRAW_PASS_EMOJI,
+};
+
 
 static float get_glyph_width(FontId font_id, wchar_t codepoint);
-static bool is_emoji(wchar_t codepoint);
-static Texture get_emoji_texture(FontId font_id, wchar_t emoji_codepoint);
+static void load_font(FontId font_id, const char *path, float size, EmojiSize emoji_size);
+static Glyph *get_glyph(FontId font_id, wchar_t codepoint);
+static Glyph *rasterise_glyph(GlyphAtlas *atlas, wchar_t codepoint);
+static void draw_glyph(FontId font_id, wchar_t codepoint, Vector2 pos, Color color);
+static void begin_glyph_pass();
+static void end_glyph_pass();
+#ifdef SDF_FONTS
+static const char *sdf_shader_glsl_header();
+#endif
+template <typename Char>
+static void draw_text(FontId font_id, Vector2 pos, const Char *text, size_t text_len, Color color);
+template <typename Char>
+static void draw_text_pass(FontId font_id, Vector2 pos, const Char *text, size_t text_len, Color color, DrawPass pass);
+template <typename Char>
+static size_t wrap_text(common::BasicLines<Char> *lines, float *xs, FontId font_id, Char *text, size_t begin, size_t text_len, float max_line_width, WrapResync<Char> *resync);
+template <typename Char>
+static void reserve_xs(common::BasicLines<Char> *lines, size_t count);
+template <typename T>
+static void shrink_array(T **items, uint32_t *cap, uint32_t count);
+template <typename Char>
+static void index_line_emoji_runs(common::BasicLines<Char> *lines, const Char *text);
+static void *grow_array(void *items, size_t new_size);
+template <typename Char>
+static void build_text_batch(FontId font_id, common::BasicLines<Char> *lines);
+static void invalidate_text_batch(common::TextBatch *batch);
+static void touch_text_batch(common::TextBatch *batch);
+static void unlink_text_batch(common::TextBatch *batch);
+static bool is_invisible(wchar_t codepoint);
+static uint8_t line_break_class(wchar_t codepoint);
+static bool line_break_before(common::LineBreakState *state, wchar_t codepoint);
+static size_t decode_codepoint(const wchar_t *text, size_t text_len, wchar_t *codepoint);
+static size_t decode_codepoint(const char *text, size_t text_len, wchar_t *codepoint);
+static size_t encode_codepoint(wchar_t codepoint, char *text);
+static size_t ascii_utf8_to_utf32(const char *src, size_t src_len, wchar_t *dst);
+static size_t ascii_utf32_to_utf8(const wchar_t *src, size_t src_len, char *dst);
+template <typename Char>
+static TextUnit next_text_unit(const Char *text, size_t text_len);
+template <typename Char>
+static TextUnit next_line_text_unit(common::BasicLines<Char> *lines, common::BasicLine<Char> line, size_t i, size_t *run_idx);
+static float text_unit_width(FontId font_id, TextUnit unit);
+static void index_emoji(const char *file_name, size_t slot);
+static uint16_t emoji_trie_child(uint16_t node, wchar_t codepoint);
+template <typename Char>
+static size_t match_emoji(const Char *text, size_t text_len, int *slot);
+static Rectangle emoji_atlas_cell(EmojiAtlas *atlas, size_t slot);
+static void decode_emoji(size_t slot, Image resized[EMOJI_SIZE_COUNT]);
+static EmojiCacheHeader emoji_cache_header();
+static bool load_emoji_cache(EmojiCacheHeader expected);
+static void pack_emoji(size_t slot, Image atlas_imgs[EMOJI_SIZE_COUNT]);
+static void pack_all_emoji(Image atlas_imgs[EMOJI_SIZE_COUNT], unsigned thread_count);
+static size_t claim_emoji_slot();
+static void save_emoji_cache(EmojiCacheHeader header, Image atlas_imgs[EMOJI_SIZE_COUNT]);
+#ifdef EMOJI_LAZY_LOADING
+static void build_emoji_cache(EmojiCacheHeader header);
+static void upload_built_emoji();
+static void upload_packed_emoji(size_t slot);
+#endif
+static int compare_emoji_file_names(const void *a, const void *b);
+static void request_emoji(size_t slot);
+static void draw_emoji(FontId font_id, int slot, Vector2 pos);
 
 
-static FontData g_font_data[FONT_ID_COUNT];
-static Emoji    g_emoji_arrays[EMOJI_SIZE_COUNT][EMOJI_COUNT];
+static FontData      g_font_data[FONT_ID_COUNT];
+static GlyphAtlas    g_glyph_atlases[FONT_ID_COUNT];
+static size_t        g_glyph_atlas_count;
+static Shader        g_sdf_shader;
+static bool          g_is_sdf = false; // 'SDF_FONTS' and the shader compiled
+static Material      g_text_material;
+static common::TextBatch *g_text_batches_head; // Most recently drawn
+static common::TextBatch *g_text_batches_tail;
+static size_t        g_text_batch_count;
+static uint64_t      g_frame; // Counted by 'common::update'
+static TextDraw     *g_text_draws;
+static size_t        g_text_draw_count;
+static size_t        g_text_draw_cap;
+template <typename Char>
+static common::BasicLines<Char> g_rewrap_lines; // Lines wrapped by 'Lines::rewrap' before they are spliced in
+static CodepointTable<float> g_glyph_advances[FONT_ID_COUNT]; // Negative means "not rasterised yet"
+static EmojiAtlas    g_emoji_atlases[EMOJI_SIZE_COUNT];
+static char          g_emoji_cache_path[EMOJI_CACHE_PATH_CAPACITY];
+static size_t        g_emoji_count;
+static wchar_t       g_emoji_codes[EMOJI_COUNT]; // First codepoint of the sequence
+static char         *g_emoji_file_names[EMOJI_COUNT];
+static uint8_t       g_emoji_states[EMOJI_COUNT];
+static uint16_t      g_emoji_load_queue[EMOJI_COUNT];
+static size_t        g_emoji_load_queue_len;
+static std::atomic<bool>   g_are_emoji_claimed[EMOJI_COUNT]; // By a packing worker, see 'claim_emoji_slot'
+static std::atomic<size_t> g_next_emoji_slot(0);
+#ifdef EMOJI_LAZY_LOADING
+static Image         g_built_emoji_imgs[EMOJI_SIZE_COUNT]; // Atlases packed by 'build_emoji_cache'
+static std::thread   g_emoji_builder;
+static std::atomic<bool> g_are_emoji_built(false);
+static std::atomic<bool> g_is_emoji_build_stopped(false); // Workers claim no more slots and the cache is not saved
+static std::atomic<bool> g_are_emoji_packed[EMOJI_COUNT]; // Cells of the slot in 'g_built_emoji_imgs' are written
+static std::mutex    g_emoji_request_mutex;
+static uint16_t      g_emoji_requests[EMOJI_COUNT]; // Slots drawn before they were packed, the builder takes them first
+static size_t        g_emoji_request_count;
+#endif
+static const int     g_emoji_sizes[EMOJI_SIZE_COUNT] = {
+#define X(emoji_size) emoji_size,
+    LIST_OF_EMOJI_SIZES
+#undef X
+};
+
+// Emoji trie roots. 'g_emoji_page_index' maps the high bits of a codepoint
+// to one of 'g_emoji_pages' (page 0 is always empty), the page maps the low
+// bits to a node of 'g_emoji_trie' (0 means "no emoji starts here")
+static uint8_t  g_emoji_page_index[UNICODE_CODEPOINT_COUNT/EMOJI_PAGE_SIZE];
+static uint16_t g_emoji_pages[EMOJI_PAGE_CAPACITY][EMOJI_PAGE_SIZE];
+static size_t   g_emoji_page_count = 1;
+static EmojiTrieNode g_emoji_trie[EMOJI_TRIE_CAPACITY];
+static size_t        g_emoji_trie_len = 1; // Node 0 is reserved for "none"
 
 
 void common::init()
 {
+#ifdef SDF_FONTS
+    // Fonts are rasterised as usual when the shader can't be used, so it
+    // is compiled before they are loaded
+    const char *sdf_shader_header = sdf_shader_glsl_header();
+    if (sdf_shader_header != nullptr) {
+        // Alpha of the glyph texture is the distance to the glyph outline
+        char sdf_shader_code[1024];
+        snprintf(sdf_shader_code, sizeof(sdf_shader_code), "%s%s", sdf_shader_header,
+            "uniform sampler2D texture0;\n"
+            "uniform vec4 colDiffuse;\n"
+            "void main()\n"
+            "{\n"
+            "    float dist = TEXTURE(texture0, fragTexCoord).a - 0.5;\n"
+            "    float dist_per_fragment = length(vec2(dFdx(dist), dFdy(dist)));\n"
+            "    float alpha = smoothstep(-dist_per_fragment, dist_per_fragment, dist);\n"
+            "    FRAG_COLOR = vec4(fragColor.rgb*colDiffuse.rgb, fragColor.a*colDiffuse.a*alpha);\n"
+            "}\n");
+        g_sdf_shader = LoadShaderFromMemory(nullptr, sdf_shader_code);
+        g_is_sdf = g_sdf_shader.id != rlGetShaderIdDefault();
+    }
+    if (!g_is_sdf) fprintf(stderr, "WARNING: Could not compile the SDF shader, fonts are rasterised\n");
+#endif
+
 #define X(name, path, size, emoji_size) \
-    g_font_data[FONT_ID_ ## name] = { \
-        LoadFontEx(path, size, nullptr, FONT_GLYPH_COUNT), \
-        emoji_size, \
-    };
+    load_font(FONT_ID_ ## name, path, size, emoji_size);
     LIST_OF_FONTS
 #undef X
 
+    g_text_material = LoadMaterialDefault();
+    if (g_is_sdf) g_text_material.shader = g_sdf_shader;
+
     // Open emoji directory
     DIR *emoji_dir;
     if ((emoji_dir = opendir(EMOJI_DIR_PATH)) == nullptr) {
@@ -50,257 +403,1888 @@ void common::init()
         exit(1);
     }
 
-    // Load emoji images and its codepoints from the directory
+    // Index emoji sequences from the file names. Names are sorted so slots
+    // do not depend on the directory order and match the cache
     struct dirent *dp;
-    size_t emoji_image_i = 0;
-    struct { Image img; wchar_t code; } emoji_images[EMOJI_COUNT];
-    char path[] = EMOJI_DIR_PATH"/00000.png";
     while ((dp = readdir(emoji_dir)) != nullptr) {
         if (strcmp(dp->d_name, ".") == 0 || strcmp(dp->d_name, "..") == 0) continue;
-        strcpy(&path[sizeof(EMOJI_DIR_PATH)], dp->d_name);
-        assert(emoji_image_i < EMOJI_COUNT && "Increase 'EMOJI_COUNT'");
-        emoji_images[emoji_image_i++] = {
-            LoadImage(path),
-            (wchar_t) strtol(dp->d_name, NULL, 16),
-        };
+        assert(g_emoji_count < EMOJI_COUNT && "Increase 'EMOJI_COUNT'");
+        g_emoji_file_names[g_emoji_count++] = strdup(dp->d_name);
     }
     closedir(emoji_dir);
 
-    // Load emoji arrays
-    size_t i;
-    Image emoji_img;
-#define X(emoji_size) \
-    for (i = 0; i < EMOJI_COUNT; i++) { \
-        emoji_img = ImageCopy(emoji_images[i].img); \
-        ImageResize(&emoji_img, emoji_size, emoji_size); \
-        g_emoji_arrays[EMOJI_SIZE_ ## emoji_size][i] = {\
-            emoji_images[i].code, \
-            LoadTextureFromImage(emoji_img), \
-        }; \
-        UnloadImage(emoji_img); \
+    qsort(g_emoji_file_names, g_emoji_count, sizeof(char *), compare_emoji_file_names);
+    for (size_t slot = 0; slot < g_emoji_count; slot++) {
+        g_emoji_codes[slot] = (wchar_t) strtol(g_emoji_file_names[slot], NULL, 16);
+        index_emoji(g_emoji_file_names[slot], slot);
     }
-    LIST_OF_EMOJI_SIZES
-#undef X
 
-    // Unload emoji images
-    for (size_t i = 0; i < EMOJI_COUNT; i++) {
-        UnloadImage(emoji_images[i].img);
+    // Prebaked atlases are uploaded straight from the cache
+    snprintf(g_emoji_cache_path, sizeof(g_emoji_cache_path), "%s%s",
+            GetApplicationDirectory(), EMOJI_CACHE_FILE_NAME);
+    EmojiCacheHeader cache_header = emoji_cache_header();
+    if (load_emoji_cache(cache_header)) return;
+
+    // Create emoji atlases. Without lazy loading all emoji are packed into
+    // the atlas images before the upload, otherwise atlases are uploaded
+    // empty and emoji are put in them by 'common::update'
+    size_t atlas_rows = (g_emoji_count + EMOJI_ATLAS_COLUMNS - 1)/EMOJI_ATLAS_COLUMNS;
+    Image atlas_imgs[EMOJI_SIZE_COUNT];
+    for (size_t i = 0; i < EMOJI_SIZE_COUNT; i++) {
+        g_emoji_atlases[i].cell_size = g_emoji_sizes[i];
+        atlas_imgs[i] = GenImageColor(
+                EMOJI_ATLAS_COLUMNS*g_emoji_sizes[i],
+                atlas_rows*g_emoji_sizes[i], BLANK);
+    }
+
+#ifdef EMOJI_LAZY_LOADING
+    // The cache is built in the background. Until it is done drawn emoji are
+    // taken from it one by one as soon as they are packed, they are never
+    // decoded twice. 'common::deinit' stops the build
+    for (size_t i = 0; i < EMOJI_SIZE_COUNT; i++) g_built_emoji_imgs[i] = ImageCopy(atlas_imgs[i]);
+    g_emoji_builder = std::thread(build_emoji_cache, cache_header);
+#else
+    // Decode on all cores, only the upload below needs the GL thread
+    pack_all_emoji(atlas_imgs, std::thread::hardware_concurrency());
+    memset(g_emoji_states, EMOJI_STATE_LOADED, g_emoji_count);
+    save_emoji_cache(cache_header, atlas_imgs);
+#endif
+
+    for (size_t i = 0; i < EMOJI_SIZE_COUNT; i++) {
+        g_emoji_atlases[i].texture = LoadTextureFromImage(atlas_imgs[i]);
+        UnloadImage(atlas_imgs[i]);
+    }
+}
+
+// A build that is not done is dropped, it starts again on the next launch
+void common::deinit()
+{
+#ifdef EMOJI_LAZY_LOADING
+    if (!g_emoji_builder.joinable()) return;
+
+    g_is_emoji_build_stopped = true;
+    g_emoji_builder.join();
+    for (size_t i = 0; i < EMOJI_SIZE_COUNT; i++) {
+        UnloadImage(g_built_emoji_imgs[i]);
+        g_built_emoji_imgs[i] = {};
     }
+#endif
+}
+
+void common::update()
+{
+    g_frame += 1;
+#ifdef EMOJI_LAZY_LOADING
+    if (g_are_emoji_built) upload_built_emoji();
+
+    // Upload requested emoji that are packed already, the rest wait
+    size_t load_count = 0;
+    size_t waiting_count = 0;
+    for (size_t i = 0; i < g_emoji_load_queue_len; i++) {
+        uint16_t slot = g_emoji_load_queue[i];
+        if (load_count < EMOJI_LOADS_PER_FRAME && g_are_emoji_packed[slot]) {
+            upload_packed_emoji(slot);
+            load_count += 1;
+        } else {
+            g_emoji_load_queue[waiting_count++] = slot;
+        }
+    }
+    g_emoji_load_queue_len = waiting_count;
+#endif
 }
 
 // TODO: replace '\n' with ' '
+template <typename Char>
 void common::draw_text_in_width(
         FontId font_id,
         Vector2 pos,
-        const wchar_t *text, size_t text_len,
+        const Char *text, size_t text_len,
         Color color, float in_width)
 {
     in_width -= 3*get_glyph_width(font_id, L'.'); // to reserve place for '...'
 
     float width = 0;
-    for (size_t i = 0; i < text_len; i++) {
-        float glyph_width = get_glyph_width(font_id, text[i]);
-        if (width+glyph_width > in_width) {
-            draw_wtext(font_id, pos, text, i, color);
+    TextUnit unit;
+    for (size_t i = 0; i < text_len; i += unit.len) {
+        unit = next_text_unit(&text[i], text_len - i);
+        float unit_width = text_unit_width(font_id, unit);
+        if (width+unit_width > in_width) {
+            draw_text(font_id, pos, text, i, color);
             pos.x += width;
-            draw_wtext(font_id, pos, L"...", 3, color);
+            draw_text(font_id, pos, L"...", 3, color);
             return;
         }
 
-        width += glyph_width;
+        width += unit_width;
     }
 
     // If text fits in length draw it
-    draw_wtext(font_id, pos, text, text_len, color);
+    draw_text(font_id, pos, text, text_len, color);
+}
+
+// Glyphs are submitted as prebuilt meshes (one per used atlas page) that
+// are rebuilt only after the lines change or when they were dropped for not
+// being drawn. Emoji still go through the batch because lazy loading may
+// change them from frame to frame
+template <typename Char>
+void common::draw_lines(FontId font_id, Vector2 pos, common::BasicLines<Char> *lines, Color color)
+{
+    if (lines->batch == nullptr || !lines->batch->is_valid || lines->batch->font_id != font_id) {
+        build_text_batch(font_id, lines);
+    }
+    touch_text_batch(lines->batch);
+
+    if (g_text_draw_count + lines->batch->part_count > g_text_draw_cap) {
+        size_t new_cap = g_text_draw_cap == 0 ? TEXT_DRAWS_INIT_CAPACITY : 2*g_text_draw_cap;
+        while (new_cap < g_text_draw_count + lines->batch->part_count) new_cap *= 2;
+        g_text_draws = (TextDraw *) realloc(g_text_draws, new_cap*sizeof(TextDraw));
+        if (g_text_draws == nullptr) {
+            fprintf(stderr, "ERROR: Could not grow text draws: no memory\n");
+            exit(1);
+        }
+        g_text_draw_cap = new_cap;
+    }
+    for (size_t i = 0; i < lines->batch->part_count; i++) {
+        TextBatchPart *part = &lines->batch->parts[i];
+        g_text_draws[g_text_draw_count++] = {
+            part->mesh, g_font_data[font_id].atlas->pages[part->page], pos, color,
+        };
+    }
+
+    for (size_t i = 0; i < lines->len; i++) {
+        common::BasicLine<Char> line = lines->items[i];
+        Vector2 unit_pos = { pos.x, pos.y + i*g_font_data[font_id].size };
+        size_t run_idx = line.first_emoji_run;
+        TextUnit unit;
+        for (size_t j = 0; j < line.len; j += unit.len) {
+            unit = next_line_text_unit(lines, line, j, &run_idx);
+            if (unit.emoji_slot >= 0) draw_emoji(font_id, unit.emoji_slot, unit_pos);
+            unit_pos.x += text_unit_width(font_id, unit);
+        }
+    }
+}
+
+// Meshes are drawn by OpenGL directly, so the raylib batch is drawn once
+// before all of them instead of before every message
+void common::flush_text()
+{
+    if (g_text_draw_count == 0) return;
+
+    rlDrawRenderBatchActive();
+    for (size_t i = 0; i < g_text_draw_count; i++) {
+        TextDraw *draw = &g_text_draws[i];
+        Matrix transform = {
+            1, 0, 0, draw->pos.x,
+            0, 1, 0, draw->pos.y,
+            0, 0, 1, 0,
+            0, 0, 0, 1,
+        };
+        g_text_material.maps[MATERIAL_MAP_DIFFUSE].color = draw->color;
+        g_text_material.maps[MATERIAL_MAP_DIFFUSE].texture = draw->texture;
+        DrawMesh(draw->mesh, g_text_material, transform);
+    }
+    g_text_draw_count = 0;
+}
+
+template <typename Char>
+void common::BasicLines<Char>::clear()
+{
+    this->len = 0;
+    this->emoji_run_count = 0;
+    if (this->batch != nullptr) invalidate_text_batch(this->batch);
+    this->grow_one();
 }
 
-void common::draw_lines(FontId font_id, Vector2 pos, common::Lines lines, Color color)
+template <typename Char>
+void common::BasicLines<Char>::unload()
 {
-    size_t begin_x = pos.x;
-    for (size_t i = 0; i < lines.len; i++) {
-        draw_wtext(font_id, pos, lines.items[i].text, lines.items[i].len, color);
-        pos.y += g_font_data[font_id].font.baseSize;
-        pos.x = begin_x;
+    if (this->batch != nullptr) {
+        invalidate_text_batch(this->batch);
+        free(this->batch);
     }
+    free(this->items);
+    free(this->emoji_runs);
+    free(this->xs);
+    free(this->words);
+    *this = {};
 }
 
-float common::Lines::max_line_width(FontId font_id)
+template <typename Char>
+float common::BasicLines<Char>::max_line_width()
 {
     float result = 0;
     for (size_t i = 0; i < this->len; i++) {
-        float line_len = measure_wtext(font_id, this->items[i].text, this->items[i].len);
-        if (line_len > result) result = line_len;
+        if (this->items[i].width > result) result = this->items[i].width;
     }
 
     return result;
 }
 
-void common::Lines::grow_one()
+template <typename Char>
+void common::BasicLines<Char>::grow_one()
 {
-    if (this->len < this->cap) {
-        this->items[this->len].len = 0;
-        this->len += 1;
-        return;
+    if (this->len >= this->cap) {
+        size_t new_cap = this->cap == 0 ? LINES_INIT_CAPACITY : 2*this->cap;
+        this->items = (BasicLine<Char> *) grow_array(this->items, new_cap*sizeof(BasicLine<Char>));
+        this->cap = new_cap;
     }
 
-    Line *new_buf = (Line *) malloc((this->cap+1) * sizeof(Line));
-    if (new_buf == NULL) {
-        fprintf(stderr, "ERROR: Could not grow one line: no memory\n");
-        exit(1);
+    this->items[this->len++] = {};
+}
+
+template <typename Char>
+Vector2 common::BasicLines<Char>::get_vec_to_pos(FontId font_id, size_t row, size_t col)
+{
+    Vector2 ret = { 0, (float) row*g_font_data[font_id].size };
+    if (col == 0) return ret; // Cleared lines have no 'xs'
+    assert(this->xs != nullptr && "Lines are not from 'recalc'");
+
+    size_t begin = this->items[row].text - this->text;
+    ret.x = this->xs[begin + col] - this->xs[begin];
+    return ret;
+}
+
+// A pointer to the end of a wrapped line is on that line, not on the next one
+template <typename Char>
+void common::BasicLines<Char>::find_pos(const Char *ptr, size_t *row, size_t *col)
+{
+    size_t lo = 0, hi = this->len;
+    while (hi - lo > 1) {
+        size_t mid = (lo + hi)/2;
+        if (this->items[mid].text <= ptr) lo = mid;
+        else hi = mid;
     }
 
-    memcpy(new_buf, this->items, this->len * sizeof(Line));
-    new_buf[this->len] = {};
+    if (lo > 0) {
+        BasicLine<Char> prev = this->items[lo-1];
+        if (ptr <= &prev.text[prev.len + prev.trim_whitespace_count]) lo -= 1;
+    }
 
-    this->cap += 1;
-    this->len += 1;
-    if (this->items != NULL) free(this->items);
-    this->items = new_buf;
+    *row = lo;
+    *col = ptr - this->items[lo].text;
 }
 
-Vector2 common::Lines::get_vec_to_pos(FontId font_id, size_t row, size_t col)
+// Column nearest to 'x' (from the line start). Never inside an emoji sequence
+template <typename Char>
+size_t common::BasicLines<Char>::col_at_x(size_t row, float x)
 {
-    Vector2 ret = { 0, (float) row*g_font_data[font_id].font.baseSize };
-    Line line = this->items[row];
-    for (size_t i = 0; i < col; i++) {
-        ret.x += get_glyph_width(font_id, line.text[i]);
+    BasicLine<Char> line = this->items[row];
+    if (line.len == 0) return 0;
+    assert(this->xs != nullptr && "Lines are not from 'recalc'");
+
+    const float *xs = &this->xs[line.text - this->text];
+    size_t lo = 0, hi = line.len;
+    while (lo < hi) {
+        size_t mid = (lo + hi + 1)/2;
+        if (xs[mid] - xs[0] <= x) lo = mid;
+        else hi = mid - 1;
     }
 
-    return ret;
+    // 'lo' is the last codepoint of its unit, go to the first one
+    while (lo > 0 && xs[lo-1] == xs[lo]) lo -= 1;
+
+    if (lo < line.len) {
+        size_t next = lo + 1;
+        while (next < line.len && xs[next] == xs[lo]) next += 1;
+        if (x - (xs[lo] - xs[0]) > (xs[next] - xs[0]) - x) lo = next;
+    }
+    return lo;
 }
 
-void common::Lines::recalc(FontId font_id, wchar_t *text, size_t text_len, float max_line_width)
+// Emoji sequences are matched here once and saved in 'emoji_runs', so they
+// are never split between lines and drawing does not match them again
+template <typename Char>
+void common::BasicLines<Char>::recalc(FontId font_id, Char *text, size_t text_len, float max_line_width)
 {
-    // clear all lines
-    this->len = 0;
-    memset(this->items, 0x0, this->cap*sizeof(common::Line));
-    this->grow_one();
+    this->text = text;
+    this->text_len = text_len;
+    this->word_count = 0;
+    this->clear();
     this->items[0].text = text;
+    reserve_xs(this, text_len + 1);
+    this->xs[0] = 0;
+    wrap_text<Char>(this, this->xs, font_id, text, 0, text_len, max_line_width, nullptr);
+}
+
+// A line break is decided by the text up to the first character of the
+// next line, so lines before the one preceding the edit stay the same.
+// Wrapping restarts there and stops at the first line after the edit that
+// starts where an old line started: the old lines from it are only shifted
+template <typename Char>
+void common::BasicLines<Char>::rewrap(
+        FontId font_id,
+        Char *text, size_t text_len,
+        float max_line_width,
+        size_t edit_begin, size_t edit_end, ptrdiff_t delta)
+{
+    if (this->len == 0 || this->items[0].text != text || this->text != text) {
+        this->recalc(font_id, text, text_len, max_line_width);
+        return;
+    }
+    if (this->batch != nullptr) invalidate_text_batch(this->batch);
+    this->text_len = text_len;
+
+    // Find the last line starting at or before the edit
+    size_t lo = 0, hi = this->len;
+    while (hi - lo > 1) {
+        size_t mid = (lo + hi)/2;
+        if ((size_t) (this->items[mid].text - text) <= edit_begin) lo = mid;
+        else hi = mid;
+    }
+    size_t first_row = lo > 0 ? lo - 1 : 0;
+
+    // Shift pen positions after the edit like the text was shifted. Positions
+    // that are not recalculated by the wrapping get the new offset below
+    size_t begin = this->items[first_row].text - text;
+    float begin_x = this->xs[begin];
+    reserve_xs(this, text_len + 1);
+    memmove(&this->xs[edit_end], &this->xs[edit_end - delta], (text_len - edit_end + 1)*sizeof(float));
+    this->xs[begin] = begin_x;
+
+    g_rewrap_lines<Char>.clear();
+    g_rewrap_lines<Char>.items[0].text = this->items[first_row].text;
+    g_rewrap_lines<Char>.items[0].break_state = this->items[first_row].break_state;
+    WrapResync<Char> resync = { this, first_row + 1, edit_end, delta, 0, 0 };
+    size_t old_row = wrap_text(&g_rewrap_lines<Char>, this->xs, font_id, text,
+            begin, text_len, max_line_width, &resync);
+    if (old_row != SIZE_MAX) {
+        float dx = resync.x - this->xs[resync.xs_end];
+        for (size_t i = resync.xs_end; i <= text_len; i++) this->xs[i] += dx;
+    }
+
+    // Runs of the resynchronised text are taken from the old lines
+    size_t tail_len = 0;
+    size_t tail_run = this->emoji_run_count;
+    if (old_row != SIZE_MAX) {
+        size_t resync_offset = this->items[old_row].text - text + delta;
+        while (g_rewrap_lines<Char>.emoji_run_count > 0 &&
+               g_rewrap_lines<Char>.emoji_runs[g_rewrap_lines<Char>.emoji_run_count-1].offset >= resync_offset) {
+            g_rewrap_lines<Char>.emoji_run_count -= 1;
+        }
+        tail_len = this->len - old_row;
+        tail_run = this->items[old_row].first_emoji_run;
+    } else {
+        old_row = this->len;
+    }
+
+    // Splice lines
+    size_t run_begin = this->items[first_row].first_emoji_run;
+    size_t new_len = first_row + g_rewrap_lines<Char>.len + tail_len;
+    if (new_len > this->cap) {
+        size_t new_cap = this->cap;
+        while (new_cap < new_len) new_cap *= 2;
+        this->items = (BasicLine<Char> *) grow_array(this->items, new_cap*sizeof(BasicLine<Char>));
+        this->cap = new_cap;
+    }
+    memmove(&this->items[first_row + g_rewrap_lines<Char>.len], &this->items[old_row], tail_len*sizeof(BasicLine<Char>));
+    memcpy(&this->items[first_row], g_rewrap_lines<Char>.items, g_rewrap_lines<Char>.len*sizeof(BasicLine<Char>));
+    this->len = new_len;
+
+    // Splice emoji runs
+    size_t tail_run_count = this->emoji_run_count - tail_run;
+    size_t new_run_count = run_begin + g_rewrap_lines<Char>.emoji_run_count + tail_run_count;
+    if (new_run_count > this->emoji_run_cap) {
+        size_t new_cap = this->emoji_run_cap == 0 ? EMOJI_RUNS_INIT_CAPACITY : this->emoji_run_cap;
+        while (new_cap < new_run_count) new_cap *= 2;
+        this->emoji_runs = (EmojiRun *) grow_array(this->emoji_runs, new_cap*sizeof(EmojiRun));
+        this->emoji_run_cap = new_cap;
+    }
+    if (new_run_count > 0) {
+        memmove(&this->emoji_runs[run_begin + g_rewrap_lines<Char>.emoji_run_count],
+                &this->emoji_runs[tail_run], tail_run_count*sizeof(EmojiRun));
+        if (g_rewrap_lines<Char>.emoji_run_count > 0) {
+            memcpy(&this->emoji_runs[run_begin], g_rewrap_lines<Char>.emoji_runs,
+                    g_rewrap_lines<Char>.emoji_run_count*sizeof(EmojiRun));
+        }
+    }
+    this->emoji_run_count = new_run_count;
+
+    // Fix indices and offsets
+    for (size_t i = first_row; i < first_row + g_rewrap_lines<Char>.len; i++) {
+        this->items[i].first_emoji_run += run_begin;
+    }
+    for (size_t i = first_row + g_rewrap_lines<Char>.len; i < new_len; i++) {
+        this->items[i].text += delta;
+        this->items[i].first_emoji_run = this->items[i].first_emoji_run - tail_run +
+            run_begin + g_rewrap_lines<Char>.emoji_run_count;
+    }
+    for (size_t i = run_begin + g_rewrap_lines<Char>.emoji_run_count; i < new_run_count; i++) {
+        this->emoji_runs[i].offset += delta;
+    }
+}
+
+template <typename Char>
+void common::BasicLines<Char>::analyse(FontId font_id, Char *text, size_t text_len)
+{
+    assert(text_len < UINT32_MAX && "Text is too long for 'Word'");
+    this->text = text;
+    this->text_len = text_len;
+    this->emoji_run_count = 0;
+    this->word_count = 0;
+
+    float x = 0;
+    float word_x = 0; // Where the last word begins
+    Word *word = nullptr;
+    bool is_after_line_feed = false;
+    LineBreakState break_state = {};
+    TextUnit unit;
+    for (size_t i = 0; i < text_len; i += unit.len) {
+        unit = next_text_unit(&text[i], text_len - i);
+        if (unit.emoji_slot >= 0) {
+            if (this->emoji_run_count >= this->emoji_run_cap) {
+                size_t new_cap = this->emoji_run_cap == 0 ? EMOJI_RUNS_INIT_CAPACITY : 2*this->emoji_run_cap;
+                this->emoji_runs = (EmojiRun *) grow_array(this->emoji_runs, new_cap*sizeof(EmojiRun));
+                this->emoji_run_cap = new_cap;
+            }
+            this->emoji_runs[this->emoji_run_count++] = { (uint32_t) i, (uint32_t) unit.len, unit.emoji_slot };
+        }
+
+        float unit_x = x;
+        if (text[i] != '\n') x += text_unit_width(font_id, unit);
+
+        bool can_break = line_break_before(&break_state, unit.codepoint);
+        if (word == nullptr || is_after_line_feed || can_break) {
+            if (this->word_count >= this->word_cap) {
+                size_t new_cap = this->word_cap == 0 ? LINES_INIT_CAPACITY : 2*this->word_cap;
+                this->words = (Word *) grow_array(this->words, new_cap*sizeof(Word));
+                this->word_cap = new_cap;
+            }
+            word = &this->words[this->word_count++];
+            *word = { (uint32_t) i, 0 };
+            word_x = unit_x;
+            is_after_line_feed = false;
+        }
 
-    float curr_line_width = 0;
-    float last_word_begin_on_width = 0;
-    size_t last_word_begin_idx = 0;
-    Line *curr_line = &this->items[0];
-    for (size_t i = 0; i < text_len; i++) {
         if (text[i] == '\n') {
-            this->grow_one();
-            curr_line = &this->items[this->len-1];
-            curr_line->len = 0;
-            curr_line->text = &text[i+1];
-            curr_line_width = 0;
-            last_word_begin_on_width = 0;
-            continue;
+            is_after_line_feed = true;
+        } else if (text[i] != ' ') {
+            // Spaces before a unit that can not start a line are inside the word
+            word->end = i + unit.len;
+            word->width = x - word_x;
         }
+    }
 
-        float glyph_width = get_glyph_width(font_id, text[i]);
-        if (curr_line_width+glyph_width > max_line_width) {
-            if (text[i] == ' ') {
-                do {
-                    curr_line->trim_whitespace_count += 1;
-                    if (++i >= text_len) return;
-                } while (text[i] == ' ');
-                this->grow_one();
-                curr_line = &this->items[this->len-1];
-                curr_line->len = 1;
-                curr_line->text = &text[i];
-                curr_line_width = glyph_width;
-            } else if (curr_line_width - last_word_begin_on_width + glyph_width >= max_line_width) {
-                this->grow_one();
-                curr_line = &this->items[this->len-1];
-                curr_line->len = 1;
-                curr_line->text = &text[i];
-                curr_line_width = glyph_width;
-                last_word_begin_on_width = 0;
-            } else {
-                curr_line->len -= i - last_word_begin_idx + 1;
-                this->grow_one();
-                curr_line = &this->items[this->len-1];
-                curr_line->text = &text[last_word_begin_idx];
-                curr_line->len = i - last_word_begin_idx + 1;
-                curr_line_width = curr_line_width - last_word_begin_on_width + glyph_width;
-                last_word_begin_on_width = 0;
+    // Analysed text is kept as long as its message, so without spare capacity
+    shrink_array(&this->words, &this->word_cap, this->word_count);
+    shrink_array(&this->emoji_runs, &this->emoji_run_cap, this->emoji_run_count);
+}
+
+// Same breaks as 'wrap_text', but a word that fits is placed at once. Only
+// words that overflow the line are measured again, unit by unit
+template <typename Char>
+void common::BasicLines<Char>::wrap(FontId font_id, float max_line_width)
+{
+    assert(this->text != nullptr && "Lines are not analysed");
+
+    this->len = 0;
+    if (this->batch != nullptr) invalidate_text_batch(this->batch);
+    this->grow_one();
+    this->items[0].text = this->text;
+
+    BasicLine<Char> *curr_line = &this->items[0];
+    float line_width = 0;
+    auto start_line = [&](size_t offset) {
+        curr_line->width = line_width;
+        this->grow_one();
+        curr_line = &this->items[this->len-1];
+        curr_line->text = &this->text[offset];
+        line_width = 0;
+    };
+
+    float space_width = text_unit_width(font_id, { 1, -1, ' ' });
+    size_t run_idx = 0;
+    size_t next_word_begin = 0;
+    for (size_t i = 0; i < this->word_count; i++) {
+        Word word = this->words[i];
+        size_t word_end = word.end;
+        size_t spaces_end = word_end;
+        while (spaces_end < this->text_len && this->text[spaces_end] == ' ') spaces_end++;
+        size_t space_count = spaces_end - word_end;
+        bool ends_line = spaces_end < this->text_len && this->text[spaces_end] == '\n';
+        size_t begin = next_word_begin;
+        next_word_begin = ends_line ? spaces_end + 1 : spaces_end;
+
+        if (line_width + word.width <= max_line_width + WRAP_EPSILON) {
+            curr_line->len += word_end - begin;
+            line_width += word.width;
+        } else {
+            // Break the word where it overflows like 'wrap_text' does
+            size_t word_begin = begin;
+            float word_width = 0; // From 'word_begin'
+            TextUnit unit;
+            for (size_t j = begin; j < word_end; j += unit.len) {
+                while (run_idx < this->emoji_run_count && this->emoji_runs[run_idx].offset < j) run_idx++;
+                if (run_idx < this->emoji_run_count && this->emoji_runs[run_idx].offset == j) {
+                    unit = { this->emoji_runs[run_idx].len, this->emoji_runs[run_idx].slot, 0 };
+                } else {
+                    unit.len = decode_codepoint(&this->text[j], this->text_len - j, &unit.codepoint);
+                    unit.emoji_slot = -1;
+                }
+                float unit_width = text_unit_width(font_id, unit);
+
+                if (line_width + unit_width <= max_line_width + WRAP_EPSILON) {
+                    curr_line->len += unit.len;
+                    line_width += unit_width;
+                    word_width += unit_width;
+                } else if (this->text[j] == ' ') {
+                    // Spaces inside the word that do not fit end the line too
+                    size_t spaces_end = j;
+                    while (this->text[spaces_end] == ' ') spaces_end++;
+                    curr_line->trim_whitespace_count += spaces_end - j;
+                    start_line(spaces_end);
+                    word_begin = spaces_end;
+                    word_width = 0;
+                    unit.len = spaces_end - j;
+                } else if (word_width + unit_width >= max_line_width - WRAP_EPSILON) {
+                    start_line(j);
+                    curr_line->len = unit.len;
+                    line_width = unit_width;
+                    word_begin = j;
+                    word_width = unit_width;
+                } else {
+                    curr_line->len -= j - word_begin;
+                    line_width -= word_width;
+                    start_line(word_begin);
+                    curr_line->len = j - word_begin + unit.len;
+                    line_width = word_width + unit_width;
+                    word_width = line_width;
+                }
             }
+        }
+
+        // Spaces that do not fit stay at the end of the line
+        float spaces_width = space_count*space_width;
+        if (space_count == 0 || line_width + spaces_width <= max_line_width + WRAP_EPSILON) {
+            curr_line->len += space_count;
+            line_width += spaces_width;
         } else {
-            curr_line_width += glyph_width;
-            curr_line->len += 1;
-            if (text[i] == ' ') {
-                last_word_begin_on_width = curr_line_width;
-                last_word_begin_idx = i+1;
+            size_t j = word_end;
+            while (j < spaces_end && line_width + space_width <= max_line_width + WRAP_EPSILON) {
+                line_width += space_width;
+                j++;
             }
+            curr_line->len += j - word_end;
+            curr_line->trim_whitespace_count += spaces_end - j;
+            if (spaces_end < this->text_len) start_line(spaces_end);
+        }
+
+        if (ends_line) start_line(spaces_end + 1);
+    }
+
+    curr_line->width = line_width;
+    index_line_emoji_runs(this, this->text);
+}
+
+void *common::Arena::alloc(size_t size)
+{
+    size = (size + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+    while (this->curr != nullptr && this->curr->used + size > this->curr->size) {
+        this->curr = this->curr->next;
+    }
+
+    if (this->curr == nullptr) {
+        size_t block_size = size > ARENA_BLOCK_SIZE ? size : ARENA_BLOCK_SIZE;
+        ArenaBlock *block = (ArenaBlock *) malloc(sizeof(ArenaBlock) + block_size);
+        if (block == nullptr) {
+            fprintf(stderr, "ERROR: Could not allocate arena block: no memory\n");
+            exit(1);
         }
-        /*puts("========================");*/
-        /*printf("Last word begin on: %f\n", last_word_begin_on_width);*/
-        /*printf("Glyph width:        %f\n", glyph_width);*/
-        /*printf("Max line width:     %f\n", max_line_width);*/
-        /*printf("Current line width: %f\n", curr_line_width);*/
-        /*puts("========================");*/
+
+        *block = { this->first, block_size, 0 };
+        this->first = block;
+        this->curr = block;
+    }
+
+    void *result = (unsigned char *) (this->curr + 1) + this->curr->used;
+    this->curr->used += size;
+    return result;
+}
+
+void common::Arena::reset()
+{
+    for (ArenaBlock *it = this->first; it != nullptr; it = it->next) it->used = 0;
+    this->curr = this->first;
+}
+
+void common::Arena::unload()
+{
+    while (this->first != nullptr) {
+        ArenaBlock *next = this->first->next;
+        free(this->first);
+        this->first = next;
     }
+    this->curr = nullptr;
 }
 
 float common::font_size(FontId font_id)
 {
-    return g_font_data[font_id].font.baseSize;
+    return g_font_data[font_id].size;
 }
 
 void common::draw_wtext(FontId font_id, Vector2 pos, const wchar_t *wtext, size_t wtext_len, Color color)
 {
-    for (size_t i = 0; i < wtext_len; i++) {
-        wchar_t codepoint = wtext[i];
-        if (codepoint == 0xfe0f) continue; // skip 'variation selector'
-        if (is_emoji(codepoint)) {
-            DrawTextureV(get_emoji_texture(font_id, codepoint), pos, WHITE);
-        } else {
-            DrawTextCodepoint(
-                    g_font_data[font_id].font, codepoint,
-                    pos, g_font_data[font_id].font.baseSize, color);
-        }
-        pos.x += get_glyph_width(font_id, codepoint);
-    }
+    draw_text(font_id, pos, wtext, wtext_len, color);
 }
 
 float common::measure_wtext(FontId font_id, const wchar_t *text, size_t text_len)
 {
     float result = 0;
-    for (size_t i = 0; i < text_len; i++) {
-        result += get_glyph_width(font_id, text[i]);
+    TextUnit unit;
+    for (size_t i = 0; i < text_len; i += unit.len) {
+        unit = next_text_unit(&text[i], text_len - i);
+        result += text_unit_width(font_id, unit);
+    }
+
+    return result;
+}
+
+template <typename Char>
+float common::measure_text_in_width(FontId font_id, const Char *text, size_t text_len, float max_width)
+{
+    float result = 0;
+    TextUnit unit;
+    for (size_t i = 0; i < text_len; i += unit.len) {
+        unit = next_text_unit(&text[i], text_len - i);
+        result += text_unit_width(font_id, unit);
+        if (result >= max_width) return max_width;
     }
 
     return result;
 }
 
+// ASCII is converted in blocks, everything else one codepoint at a time
+size_t common::utf8_to_utf32(const char *src, size_t src_len, wchar_t *dst)
+{
+    size_t i = 0;
+    size_t len = 0;
+    while (i < src_len) {
+        size_t ascii_len = ascii_utf8_to_utf32(&src[i], src_len - i, &dst[len]);
+        i += ascii_len;
+        len += ascii_len;
+        if (i >= src_len) break;
+        i += decode_codepoint(&src[i], src_len - i, &dst[len++]);
+    }
+
+    return len;
+}
+
+size_t common::utf32_to_utf8(const wchar_t *src, size_t src_len, char *dst)
+{
+    size_t i = 0;
+    size_t len = 0;
+    while (i < src_len) {
+        size_t ascii_len = ascii_utf32_to_utf8(&src[i], src_len - i, &dst[len]);
+        i += ascii_len;
+        len += ascii_len;
+        if (i >= src_len) break;
+        len += encode_codepoint(src[i++], &dst[len]);
+    }
+
+    return len;
+}
+
 // PRIVATE FUNCTION IMPLEMENTATIONS //////////////////////////////
 
 static float get_glyph_width(FontId font_id, wchar_t codepoint)
 {
-    Font font = g_font_data[font_id].font;
-    if (!is_emoji(codepoint)) {
-        int cp_idx = GetGlyphIndex(font, codepoint);
-        return (font.glyphs[cp_idx].advanceX == 0) ?
-            font.recs[cp_idx].width :
-            font.glyphs[cp_idx].advanceX;
-    } else {
-        return font.baseSize;
+    if (is_invisible(codepoint)) return 0;
+
+    float advance = g_glyph_advances[font_id].get(codepoint);
+    if (advance < 0) {
+        advance = get_glyph(font_id, codepoint)->advance*g_font_data[font_id].scale;
+        if ((uint32_t) codepoint < UNICODE_CODEPOINT_COUNT) {
+            g_glyph_advances[font_id].set(codepoint, advance);
+        }
     }
+
+    return advance;
 }
 
-static bool is_emoji(wchar_t codepoint)
+static void load_font(FontId font_id, const char *path, float size, EmojiSize emoji_size)
 {
-    static_assert(EMOJI_SIZE_COUNT > 0, "'is_emoji' that we have emoji");
-    for (size_t i = 0; i < EMOJI_COUNT; i++) {
-        if (codepoint == g_emoji_arrays[0][i].code) return true;
+    GlyphAtlas *atlas = nullptr;
+    for (size_t i = 0; g_is_sdf && i < g_glyph_atlas_count; i++) {
+        if (strcmp(g_glyph_atlases[i].path, path) == 0) atlas = &g_glyph_atlases[i];
+    }
+
+    if (atlas == nullptr) {
+        atlas = &g_glyph_atlases[g_glyph_atlas_count++];
+        atlas->path = path;
+        atlas->file_data = LoadFileData(path, &atlas->file_size);
+        if (atlas->file_data == nullptr) {
+            fprintf(stderr, "ERROR: Could not load font '%s'\n", path);
+            exit(1);
+        }
+        int font_offset = stbtt_GetFontOffsetForIndex(atlas->file_data, 0);
+        if (font_offset < 0 || !stbtt_InitFont(&atlas->font_info, atlas->file_data, font_offset)) {
+            fprintf(stderr, "ERROR: Could not parse font '%s'\n", path);
+            exit(1);
+        }
+        if (g_is_sdf) {
+            atlas->font_size = SDF_FONT_BASE_SIZE;
+            atlas->font_type = FONT_SDF;
+        } else {
+            atlas->font_size = size;
+            atlas->font_type = FONT_DEFAULT;
+        }
+        int ascent, descent, line_gap;
+        stbtt_GetFontVMetrics(&atlas->font_info, &ascent, &descent, &line_gap);
+        atlas->font_scale = stbtt_ScaleForPixelHeight(&atlas->font_info, atlas->font_size);
+        atlas->ascent = (int) (ascent*atlas->font_scale);
+        atlas->glyph_idxs.init(0);
     }
 
-    return false;
+    g_font_data[font_id] = { atlas, size, size/atlas->font_size, emoji_size };
+    g_glyph_advances[font_id].init(-1);
+}
+
+static Glyph *get_glyph(FontId font_id, wchar_t codepoint)
+{
+    GlyphAtlas *atlas = g_font_data[font_id].atlas;
+    uint32_t glyph_idx = atlas->glyph_idxs.get(codepoint);
+    return glyph_idx == 0 ?
+        rasterise_glyph(atlas, codepoint) :
+        &atlas->glyphs[glyph_idx-1];
 }
 
-static Texture get_emoji_texture(FontId font_id, wchar_t emoji_codepoint)
+// Codepoints that are missing in the font share the glyph of '?'. Metrics
+// and SDF parameters are the ones raylib's 'LoadFontData' uses
+static Glyph *rasterise_glyph(GlyphAtlas *atlas, wchar_t codepoint)
 {
-    Emoji *emoji = g_emoji_arrays[g_font_data[font_id].emoji_size];
-    for (size_t i = 0; i < EMOJI_COUNT; i++) {
-        if (emoji[i].code == emoji_codepoint) {
-            return emoji[i].texture;
+    int glyph_index = 0;
+    if ((uint32_t) codepoint < UNICODE_CODEPOINT_COUNT) {
+        glyph_index = stbtt_FindGlyphIndex(&atlas->font_info, codepoint);
+    }
+
+    if (glyph_index == 0) {
+        assert(codepoint != '?' && "Font has no fallback glyph");
+        uint32_t fallback_idx = atlas->glyph_idxs.get('?');
+        if (fallback_idx == 0) {
+            rasterise_glyph(atlas, '?');
+            fallback_idx = atlas->glyph_idxs.get('?');
+        }
+        if ((uint32_t) codepoint < UNICODE_CODEPOINT_COUNT) {
+            atlas->glyph_idxs.set(codepoint, fallback_idx);
+        }
+        return &atlas->glyphs[fallback_idx-1];
+    }
+
+    if (atlas->glyph_count >= atlas->glyph_cap) {
+        atlas->glyph_cap = atlas->glyph_cap == 0 ? 256 : 2*atlas->glyph_cap;
+        atlas->glyphs = (Glyph *) realloc(atlas->glyphs, atlas->glyph_cap*sizeof(Glyph));
+        if (atlas->glyphs == nullptr) {
+            fprintf(stderr, "ERROR: Could not grow glyphs: no memory\n");
+            exit(1);
+        }
+    }
+
+    int width = 0, height = 0, offset_x = 0, offset_y = 0;
+    unsigned char *bitmap = nullptr;
+    if (atlas->font_type == FONT_SDF) {
+        bitmap = stbtt_GetGlyphSDF(&atlas->font_info, atlas->font_scale, glyph_index,
+                GLYPH_SDF_PADDING, GLYPH_SDF_ON_EDGE_VALUE, GLYPH_SDF_PIXEL_DIST_SCALE,
+                &width, &height, &offset_x, &offset_y);
+    } else {
+        bitmap = stbtt_GetGlyphBitmap(&atlas->font_info, atlas->font_scale, atlas->font_scale,
+                glyph_index, &width, &height, &offset_x, &offset_y);
+    }
+    if (bitmap == nullptr) {
+        width = 0;
+        height = 0;
+    }
+    int advance_width, left_side_bearing;
+    stbtt_GetGlyphHMetrics(&atlas->font_info, glyph_index, &advance_width, &left_side_bearing);
+    float advance = (int) (advance_width*atlas->font_scale);
+    if (advance == 0) advance = width;
+
+    Glyph *glyph = &atlas->glyphs[atlas->glyph_count++];
+
+    // Spaces come as blank or no bitmaps. They keep the advance, but are
+    // not packed, drawn or put in meshes
+    bool is_blank = true;
+    for (int i = 0; is_blank && i < width*height; i++) is_blank = bitmap[i] == 0;
+    if (is_blank) {
+        width = 0;
+        height = 0;
+    }
+
+    *glyph = {
+        { 0, 0, (float) width + 2*GLYPH_PADDING, (float) height + 2*GLYPH_PADDING },
+        0,
+        (float) offset_x,
+        (float) (offset_y + atlas->ascent),
+        advance,
+    };
+    atlas->glyph_idxs.set(codepoint, atlas->glyph_count);
+
+    if (width > 0 && height > 0) {
+        // Find place in the last page, move to the next row or add a page
+        int rec_width = glyph->rec.width, rec_height = glyph->rec.height;
+        assert(rec_width <= GLYPH_ATLAS_PAGE_SIZE && rec_height <= GLYPH_ATLAS_PAGE_SIZE);
+        if (atlas->page_count > 0 && atlas->pen_x + rec_width > GLYPH_ATLAS_PAGE_SIZE) {
+            atlas->pen_x = 0;
+            atlas->pen_y += atlas->row_height;
+            atlas->row_height = 0;
+        }
+        if (atlas->page_count == 0 || atlas->pen_y + rec_height > GLYPH_ATLAS_PAGE_SIZE) {
+            assert(atlas->page_count < GLYPH_ATLAS_PAGE_CAPACITY && "Increase 'GLYPH_ATLAS_PAGE_CAPACITY'");
+            Image page_img = GenImageColor(GLYPH_ATLAS_PAGE_SIZE, GLYPH_ATLAS_PAGE_SIZE, BLANK);
+            ImageFormat(&page_img, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA);
+            atlas->pages[atlas->page_count] = LoadTextureFromImage(page_img);
+            if (atlas->font_type == FONT_SDF) {
+                SetTextureFilter(atlas->pages[atlas->page_count], TEXTURE_FILTER_BILINEAR);
+            }
+            atlas->page_count += 1;
+            UnloadImage(page_img);
+            atlas->pen_x = 0;
+            atlas->pen_y = 0;
+            atlas->row_height = 0;
         }
+
+        glyph->page = atlas->page_count-1;
+        glyph->rec.x = atlas->pen_x;
+        glyph->rec.y = atlas->pen_y;
+        atlas->pen_x += rec_width;
+        if (rec_height > atlas->row_height) atlas->row_height = rec_height;
+
+        // Upload the bitmap as white with alpha like raylib does for fonts
+        unsigned char *pixels = (unsigned char *) calloc(rec_width*rec_height, 2);
+        for (int y = 0; y < height; y++) {
+            for (int x = 0; x < width; x++) {
+                unsigned char *pixel = &pixels[2*((y+GLYPH_PADDING)*rec_width + x+GLYPH_PADDING)];
+                pixel[0] = 0xff;
+                pixel[1] = bitmap[y*width + x];
+            }
+        }
+        UpdateTextureRec(atlas->pages[glyph->page], glyph->rec, pixels);
+        free(pixels);
     }
 
-    assert(0 && "Unknown emoji");
+    if (atlas->font_type == FONT_SDF) {
+        stbtt_FreeSDF(bitmap, nullptr);
+    } else {
+        stbtt_FreeBitmap(bitmap, nullptr);
+    }
+    return glyph;
+}
+
+static void draw_glyph(FontId font_id, wchar_t codepoint, Vector2 pos, Color color)
+{
+    Glyph *glyph = get_glyph(font_id, codepoint);
+    if (glyph->rec.width <= 2*GLYPH_PADDING) return; // Nothing to draw (e.g. space)
+
+    float scale = g_font_data[font_id].scale;
+    DrawTexturePro(g_font_data[font_id].atlas->pages[glyph->page], glyph->rec,
+            { pos.x + (glyph->offset_x - GLYPH_PADDING)*scale,
+              pos.y + (glyph->offset_y - GLYPH_PADDING)*scale,
+              glyph->rec.width*scale, glyph->rec.height*scale },
+            { 0, 0 }, 0, color);
+}
+
+static void begin_glyph_pass()
+{
+    if (g_is_sdf) BeginShaderMode(g_sdf_shader);
+}
+
+static void end_glyph_pass()
+{
+    if (g_is_sdf) EndShaderMode();
 }
+
+#ifdef SDF_FONTS
+// Declarations the SDF shader needs in the GLSL of the OpenGL version raylib
+// was built for, the way raylib picks its default shaders. OpenGL 1.1 has no
+// shaders, then nullptr is returned
+static const char *sdf_shader_glsl_header()
+{
+    switch (rlGetVersion()) {
+    case RL_OPENGL_21:
+        return "#version 120\n"
+            "varying vec2 fragTexCoord;\n"
+            "varying vec4 fragColor;\n"
+            "#define TEXTURE texture2D\n"
+            "#define FRAG_COLOR gl_FragColor\n";
+    case RL_OPENGL_33:
+    case RL_OPENGL_43:
+        return "#version 330\n"
+            "in vec2 fragTexCoord;\n"
+            "in vec4 fragColor;\n"
+            "out vec4 finalColor;\n"
+            "#define TEXTURE texture\n"
+            "#define FRAG_COLOR finalColor\n";
+    case RL_OPENGL_ES_20:
+        // Derivatives are an extension in OpenGL ES 2.0
+        return "#version 100\n"
+            "#extension GL_OES_standard_derivatives : enable\n"
+            "precision mediump float;\n"
+            "varying vec2 fragTexCoord;\n"
+            "varying vec4 fragColor;\n"
+            "#define TEXTURE texture2D\n"
+            "#define FRAG_COLOR gl_FragColor\n";
+    case RL_OPENGL_ES_30:
+        return "#version 300 es\n"
+            "precision mediump float;\n"
+            "in vec2 fragTexCoord;\n"
+            "in vec4 fragColor;\n"
+            "out vec4 finalColor;\n"
+            "#define TEXTURE texture\n"
+            "#define FRAG_COLOR finalColor\n";
+    default:
+        return nullptr;
+    }
+}
+#endif
+
+// Glyphs and emoji are drawn in separate passes, so each pass stays in
+// one batch and the SDF shader is not applied to emoji
+template <typename Char>
+static void draw_text(FontId font_id, Vector2 pos, const Char *text, size_t text_len, Color color)
+{
+    begin_glyph_pass();
+    draw_text_pass(font_id, pos, text, text_len, color, DRAW_PASS_GLYPHS);
+    end_glyph_pass();
+    draw_text_pass(font_id, pos, text, text_len, color, DRAW_PASS_EMOJI);
+}
+
+template <typename Char>
+static void draw_text_pass(FontId font_id, Vector2 pos, const Char *text, size_t text_len, Color color, DrawPass pass)
+{
+    TextUnit unit;
+    for (size_t i = 0; i < text_len; i += unit.len) {
+        unit = next_text_unit(&text[i], text_len - i);
+        if (unit.emoji_slot >= 0) {
+            if (pass == DRAW_PASS_EMOJI) draw_emoji(font_id, unit.emoji_slot, pos);
+        } else if (!is_invisible(unit.codepoint)) {
+            if (pass == DRAW_PASS_GLYPHS) draw_glyph(font_id, unit.codepoint, pos, color);
+        }
+        pos.x += text_unit_width(font_id, unit);
+    }
+}
+
+// Wraps the text from 'begin' (a line start) appending to the last line of
+// 'lines' and fills 'xs' from 'xs[begin]'. With 'resync' set wrapping stops
+// before a line that starts at 'min_offset' or later where one of the old
+// lines started. Returns the old line or 'SIZE_MAX' if wrapping reached the
+// end of the text
+template <typename Char>
+static size_t wrap_text(
+        common::BasicLines<Char> *lines,
+        float *xs,
+        FontId font_id,
+        Char *text, size_t begin, size_t text_len,
+        float max_line_width,
+        WrapResync<Char> *resync)
+{
+    size_t resync_row = SIZE_MAX;
+    float x = xs[begin];
+    size_t xs_end = begin; // 'xs' before it are written, 'x' is the position at it
+    common::BasicLine<Char> *curr_line = &lines->items[lines->len-1];
+    auto finish_line = [&]() {
+        size_t line_begin = curr_line->text - text;
+        curr_line->width = xs[line_begin + curr_line->len] - xs[line_begin];
+    };
+    auto start_line = [&](size_t offset, common::LineBreakState state) -> bool {
+        finish_line();
+        if (resync != nullptr && offset >= resync->min_offset) {
+            common::BasicLines<Char> *old = resync->old_lines;
+            size_t old_offset = offset - resync->delta;
+            while (resync->old_row < old->len && (size_t) (old->items[resync->old_row].text - text) < old_offset) {
+                resync->old_row += 1;
+            }
+            common::BasicLine<Char> *old_line = &old->items[resync->old_row];
+            if (resync->old_row < old->len && (size_t) (old_line->text - text) == old_offset &&
+                    old_line->break_state.cls == state.cls &&
+                    old_line->break_state.after_space == state.after_space) {
+                resync_row = resync->old_row;
+                resync->xs_end = xs_end;
+                resync->x = x;
+                return true;
+            }
+        }
+
+        lines->grow_one();
+        curr_line = &lines->items[lines->len-1];
+        curr_line->text = &text[offset];
+        curr_line->break_state = state;
+        return false;
+    };
+
+    float curr_line_width = 0;
+    float curr_word_width = 0; // From the last break opportunity
+    size_t curr_word_begin = begin;
+    common::LineBreakState break_state = curr_line->break_state;
+    common::LineBreakState word_break_state = break_state;
+    TextUnit unit;
+    for (size_t i = begin; i < text_len; i += unit.len) {
+        unit = next_text_unit(&text[i], text_len - i);
+        float unit_width = text[i] == '\n' ? 0 : text_unit_width(font_id, unit);
+        for (size_t j = 0; j < unit.len; j++) xs[i+j] = x;
+        x += unit_width;
+        xs_end = i + unit.len;
+
+        if (unit.emoji_slot >= 0) {
+            if (lines->emoji_run_count >= lines->emoji_run_cap) {
+                size_t new_cap = lines->emoji_run_cap == 0 ? EMOJI_RUNS_INIT_CAPACITY : 2*lines->emoji_run_cap;
+                lines->emoji_runs = (common::EmojiRun *) grow_array(lines->emoji_runs, new_cap*sizeof(common::EmojiRun));
+                lines->emoji_run_cap = new_cap;
+            }
+            lines->emoji_runs[lines->emoji_run_count++] = { (uint32_t) i, (uint32_t) unit.len, unit.emoji_slot };
+        }
+
+        common::LineBreakState unit_break_state = break_state;
+        bool can_break = line_break_before(&break_state, unit.codepoint);
+        if (text[i] == '\n') {
+            if (start_line(i+1, break_state)) goto done;
+            curr_line_width = 0;
+            curr_word_width = 0;
+            curr_word_begin = i+1;
+            word_break_state = break_state;
+            continue;
+        }
+        if (can_break) {
+            curr_word_width = 0;
+            curr_word_begin = i;
+            word_break_state = unit_break_state;
+        }
+
+        if (curr_line_width+unit_width > max_line_width + WRAP_EPSILON) {
+            if (text[i] == ' ') {
+                // Spaces stay at the end of the line, the next one starts
+                // with the first non-space that is processed again
+                for (;;) {
+                    curr_line->trim_whitespace_count += 1;
+                    if (++i >= text_len) goto done;
+                    if (text[i] != ' ') break;
+                    xs[i] = x;
+                    x += unit_width;
+                    xs_end = i+1;
+                }
+                unit = { 0, -1, ' ' };
+                if (start_line(i, break_state)) goto done;
+                curr_line_width = 0;
+                curr_word_width = 0;
+                curr_word_begin = i;
+                word_break_state = break_state;
+            } else if (curr_word_width + unit_width >= max_line_width - WRAP_EPSILON) {
+                // The word is longer than a line, so it is broken here
+                if (start_line(i, unit_break_state)) goto done;
+                curr_line->len = unit.len;
+                curr_line_width = unit_width;
+                curr_word_width = unit_width;
+                curr_word_begin = i;
+                word_break_state = unit_break_state;
+            } else {
+                // The word is moved to the next line
+                curr_line->len -= i - curr_word_begin;
+                if (start_line(curr_word_begin, word_break_state)) goto done;
+                curr_line->len = i - curr_word_begin + unit.len;
+                curr_line_width = curr_word_width + unit_width;
+                curr_word_width = curr_line_width;
+            }
+        } else {
+            curr_line_width += unit_width;
+            curr_line->len += unit.len;
+            curr_word_width += unit_width;
+        }
+    }
+
+done:
+    if (resync_row == SIZE_MAX) {
+        xs[text_len] = x;
+        finish_line();
+    }
+    index_line_emoji_runs(lines, text);
+    return resync_row;
+}
+
+// Lines and runs are both in text order, so one merge finds the first run of every line
+template <typename Char>
+static void index_line_emoji_runs(common::BasicLines<Char> *lines, const Char *text)
+{
+    size_t run_idx = 0;
+    for (size_t i = 0; i < lines->len; i++) {
+        size_t line_offset = lines->items[i].text - text;
+        while (run_idx < lines->emoji_run_count && lines->emoji_runs[run_idx].offset < line_offset) run_idx++;
+        lines->items[i].first_emoji_run = run_idx;
+    }
+}
+
+// Keeps the positions already there
+template <typename Char>
+static void reserve_xs(common::BasicLines<Char> *lines, size_t count)
+{
+    if (count <= lines->xs_cap) return;
+
+    size_t new_cap = lines->xs_cap == 0 ? LINES_INIT_CAPACITY : lines->xs_cap;
+    while (new_cap < count) new_cap *= 2;
+    lines->xs = (float *) grow_array(lines->xs, new_cap*sizeof(float));
+    lines->xs_cap = new_cap;
+}
+
+// Frees the items when there are none, so the capacity is exact
+template <typename T>
+static void shrink_array(T **items, uint32_t *cap, uint32_t count)
+{
+    if (count == *cap) return;
+
+    if (count == 0) {
+        free(*items);
+        *items = nullptr;
+    } else {
+        *items = (T *) grow_array(*items, count*sizeof(T));
+    }
+    *cap = count;
+}
+
+static void *grow_array(void *items, size_t new_size)
+{
+    void *result = realloc(items, new_size);
+    if (result == nullptr) {
+        fprintf(stderr, "ERROR: Could not grow array: no memory\n");
+        exit(1);
+    }
+    return result;
+}
+
+template <typename Char>
+static void build_text_batch(FontId font_id, common::BasicLines<Char> *lines)
+{
+    if (lines->batch == nullptr) {
+        lines->batch = (common::TextBatch *) calloc(1, sizeof(common::TextBatch));
+        if (lines->batch == nullptr) {
+            fprintf(stderr, "ERROR: Could not allocate text batch: no memory\n");
+            exit(1);
+        }
+    }
+    common::TextBatch *batch = lines->batch;
+    invalidate_text_batch(batch);
+
+    // Count quads on every page. This also rasterises the missing glyphs,
+    // so the page count is final after the pass
+    GlyphAtlas *atlas = g_font_data[font_id].atlas;
+    size_t quad_counts[GLYPH_ATLAS_PAGE_CAPACITY] = {};
+    for (size_t i = 0; i < lines->len; i++) {
+        common::BasicLine<Char> line = lines->items[i];
+        size_t run_idx = line.first_emoji_run;
+        TextUnit unit;
+        for (size_t j = 0; j < line.len; j += unit.len) {
+            unit = next_line_text_unit(lines, line, j, &run_idx);
+            if (unit.emoji_slot >= 0 || is_invisible(unit.codepoint)) continue;
+            Glyph *glyph = get_glyph(font_id, unit.codepoint);
+            if (glyph->rec.width > 2*GLYPH_PADDING) quad_counts[glyph->page] += 1;
+        }
+    }
+
+    size_t part_idxs[GLYPH_ATLAS_PAGE_CAPACITY];
+    batch->parts = (TextBatchPart *) calloc(atlas->page_count, sizeof(TextBatchPart));
+    for (size_t page = 0; page < atlas->page_count; page++) {
+        if (quad_counts[page] == 0) continue;
+        part_idxs[page] = batch->part_count;
+        TextBatchPart *part = &batch->parts[batch->part_count++];
+        part->page = page;
+        part->mesh.vertexCount = 6*quad_counts[page];
+        part->mesh.triangleCount = 2*quad_counts[page];
+        part->mesh.vertices = (float *) calloc(3*part->mesh.vertexCount, sizeof(float));
+        part->mesh.texcoords = (float *) calloc(2*part->mesh.vertexCount, sizeof(float));
+        if (part->mesh.vertices == nullptr || part->mesh.texcoords == nullptr) {
+            fprintf(stderr, "ERROR: Could not allocate text batch: no memory\n");
+            exit(1);
+        }
+        part->mesh.vertexCount = 0; // Used as a cursor below
+    }
+
+    // Fill quads the same way 'draw_glyph' places them
+    float scale = g_font_data[font_id].scale;
+    for (size_t i = 0; i < lines->len; i++) {
+        common::BasicLine<Char> line = lines->items[i];
+        Vector2 pos = { 0, i*g_font_data[font_id].size };
+        size_t run_idx = line.first_emoji_run;
+        TextUnit unit;
+        for (size_t j = 0; j < line.len; j += unit.len) {
+            unit = next_line_text_unit(lines, line, j, &run_idx);
+            if (unit.emoji_slot < 0 && !is_invisible(unit.codepoint)) {
+                Glyph *glyph = get_glyph(font_id, unit.codepoint);
+                if (glyph->rec.width > 2*GLYPH_PADDING) {
+                    float x0 = pos.x + (glyph->offset_x - GLYPH_PADDING)*scale;
+                    float y0 = pos.y + (glyph->offset_y - GLYPH_PADDING)*scale;
+                    float x1 = x0 + glyph->rec.width*scale;
+                    float y1 = y0 + glyph->rec.height*scale;
+                    float u0 = glyph->rec.x/GLYPH_ATLAS_PAGE_SIZE;
+                    float v0 = glyph->rec.y/GLYPH_ATLAS_PAGE_SIZE;
+                    float u1 = (glyph->rec.x + glyph->rec.width)/GLYPH_ATLAS_PAGE_SIZE;
+                    float v1 = (glyph->rec.y + glyph->rec.height)/GLYPH_ATLAS_PAGE_SIZE;
+
+                    // Two triangles in the order raylib uses for quads so they are not culled
+                    float quad[6][4] = {
+                        { x0, y0, u0, v0 }, { x0, y1, u0, v1 }, { x1, y1, u1, v1 },
+                        { x0, y0, u0, v0 }, { x1, y1, u1, v1 }, { x1, y0, u1, v0 },
+                    };
+                    Mesh *mesh = &batch->parts[part_idxs[glyph->page]].mesh;
+                    for (size_t k = 0; k < 6; k++) {
+                        mesh->vertices[3*mesh->vertexCount + 0] = quad[k][0];
+                        mesh->vertices[3*mesh->vertexCount + 1] = quad[k][1];
+                        mesh->texcoords[2*mesh->vertexCount + 0] = quad[k][2];
+                        mesh->texcoords[2*mesh->vertexCount + 1] = quad[k][3];
+                        mesh->vertexCount += 1;
+                    }
+                }
+            }
+            pos.x += text_unit_width(font_id, unit);
+        }
+    }
+
+    // Vertex data lives on the GPU from now on
+    for (size_t i = 0; i < batch->part_count; i++) {
+        Mesh *mesh = &batch->parts[i].mesh;
+        UploadMesh(mesh, false);
+        free(mesh->vertices);
+        free(mesh->texcoords);
+        mesh->vertices = nullptr;
+        mesh->texcoords = nullptr;
+    }
+
+    batch->font_id = font_id;
+    batch->is_valid = true;
+    touch_text_batch(batch);
+    g_text_batch_count += 1;
+
+    // Lines that scrolled away keep no meshes. Batches drawn in this frame
+    // are queued for 'flush_text', so they stay even over the capacity
+    while (g_text_batch_count > TEXT_BATCH_CAPACITY && g_text_batches_tail->drawn_frame != g_frame) {
+        invalidate_text_batch(g_text_batches_tail);
+    }
+}
+
+static void invalidate_text_batch(common::TextBatch *batch)
+{
+    if (!batch->is_valid && batch->parts == nullptr) return;
+
+    if (batch->is_valid) {
+        unlink_text_batch(batch);
+        g_text_batch_count -= 1;
+    }
+    for (size_t i = 0; i < batch->part_count; i++) {
+        UnloadMesh(batch->parts[i].mesh);
+    }
+    free(batch->parts);
+    batch->parts = nullptr;
+    batch->part_count = 0;
+    batch->is_valid = false;
+}
+
+// Moves a valid batch to the head of the list
+static void touch_text_batch(common::TextBatch *batch)
+{
+    batch->drawn_frame = g_frame;
+    if (g_text_batches_head == batch) return;
+
+    if (batch->prev != nullptr || g_text_batches_tail == batch) unlink_text_batch(batch);
+    batch->prev = nullptr;
+    batch->next = g_text_batches_head;
+    if (g_text_batches_head != nullptr) g_text_batches_head->prev = batch;
+    g_text_batches_head = batch;
+    if (g_text_batches_tail == nullptr) g_text_batches_tail = batch;
+}
+
+static void unlink_text_batch(common::TextBatch *batch)
+{
+    if (batch->prev != nullptr) batch->prev->next = batch->next;
+    else g_text_batches_head = batch->next;
+    if (batch->next != nullptr) batch->next->prev = batch->prev;
+    else g_text_batches_tail = batch->prev;
+    batch->prev = nullptr;
+    batch->next = nullptr;
+}
+
+static uint8_t line_break_class(wchar_t codepoint)
+{
+    if ((uint32_t) codepoint >= UNICODE_CODEPOINT_COUNT) return LB_AL;
+    return LB_STAGE2[LB_STAGE1[codepoint >> LB_BLOCK_SHIFT]][codepoint & ((1 << LB_BLOCK_SHIFT) - 1)];
+}
+
+// Steps over a text unit starting with 'codepoint'. Returns whether a line
+// can be broken before the unit. Only the pair rules of UAX #14 are used
+static bool line_break_before(common::LineBreakState *state, wchar_t codepoint)
+{
+    uint8_t cls = line_break_class(codepoint);
+    if (cls == LB_SP) {
+        state->after_space = true;
+        return false;
+    }
+    if (cls == LB_BK) {
+        *state = {};
+        return false;
+    }
+
+    uint8_t action = LB_PAIRS[state->cls][cls];
+    bool result = action & (state->after_space ? LB_BREAK_AFTER_SPACE : LB_BREAK);
+    if (!(action & LB_ATTACH) || state->after_space) state->cls = cls;
+    state->after_space = false;
+    return result;
+}
+
+// Variation selector and zero width joiner outside of emoji sequences
+static bool is_invisible(wchar_t codepoint)
+{
+    return codepoint == 0xfe0f || codepoint == 0x200d;
+}
+
+// Returns the number of code units the codepoint takes. 'text_len' is at least one
+static size_t decode_codepoint(const wchar_t *text, size_t text_len, wchar_t *codepoint)
+{
+    (void) text_len;
+    *codepoint = text[0];
+    return 1;
+}
+
+// Invalid UTF-8 decodes one byte at a time as U+FFFD
+static size_t decode_codepoint(const char *text, size_t text_len, wchar_t *codepoint)
+{
+    const uint8_t *bytes = (const uint8_t *) text;
+    if (bytes[0] < 0x80) {
+        *codepoint = bytes[0];
+        return 1;
+    }
+
+    size_t len;
+    uint32_t result;
+    if (bytes[0] >= 0xc2 && bytes[0] < 0xe0) {
+        len = 2;
+        result = bytes[0] & 0x1f;
+    } else if (bytes[0] >= 0xe0 && bytes[0] < 0xf0) {
+        len = 3;
+        result = bytes[0] & 0x0f;
+    } else if (bytes[0] >= 0xf0 && bytes[0] < 0xf5) {
+        len = 4;
+        result = bytes[0] & 0x07;
+    } else {
+        goto invalid;
+    }
+    if (len > text_len) goto invalid;
+    for (size_t i = 1; i < len; i++) {
+        if ((bytes[i] & 0xc0) != 0x80) goto invalid;
+        result = result << 6 | (bytes[i] & 0x3f);
+    }
+    // Overlong forms, surrogates and past the last codepoint
+    if ((len == 3 && result < 0x800) || (result >= 0xd800 && result < 0xe000) ||
+            (len == 4 && (result < 0x10000 || result >= UNICODE_CODEPOINT_COUNT))) {
+        goto invalid;
+    }
+
+    *codepoint = (wchar_t) result;
+    return len;
+
+invalid:
+    *codepoint = 0xfffd;
+    return 1;
+}
+
+// Returns the number of bytes written. Surrogates and values past the last
+// codepoint are written as U+FFFD
+static size_t encode_codepoint(wchar_t codepoint, char *text)
+{
+    uint32_t value = codepoint;
+    if ((value >= 0xd800 && value < 0xe000) || value >= UNICODE_CODEPOINT_COUNT) value = 0xfffd;
+
+    if (value < 0x80) {
+        text[0] = value;
+        return 1;
+    }
+    if (value < 0x800) {
+        text[0] = 0xc0 | value >> 6;
+        text[1] = 0x80 | (value & 0x3f);
+        return 2;
+    }
+    if (value < 0x10000) {
+        text[0] = 0xe0 | value >> 12;
+        text[1] = 0x80 | (value >> 6 & 0x3f);
+        text[2] = 0x80 | (value & 0x3f);
+        return 3;
+    }
+    text[0] = 0xf0 | value >> 18;
+    text[1] = 0x80 | (value >> 12 & 0x3f);
+    text[2] = 0x80 | (value >> 6 & 0x3f);
+    text[3] = 0x80 | (value & 0x3f);
+    return 4;
+}
+
+// Converts the ASCII at the beginning of 'src' and returns its length. Whole
+// blocks are checked and widened at once, the block that ends it is copied by byte
+static size_t ascii_utf8_to_utf32(const char *src, size_t src_len, wchar_t *dst)
+{
+    static_assert(sizeof(wchar_t) == 4, "'wchar_t' has to hold UTF-32");
+    size_t i = 0;
+#if defined(__AVX2__)
+    for (; i + 32 <= src_len; i += 32) {
+        __m256i bytes = _mm256_loadu_si256((const __m256i *) &src[i]);
+        if (_mm256_movemask_epi8(bytes) != 0) break;
+        for (size_t j = 0; j < 32; j += 8) {
+            __m256i codepoints = _mm256_cvtepu8_epi32(_mm_loadl_epi64((const __m128i *) &src[i + j]));
+            _mm256_storeu_si256((__m256i *) &dst[i + j], codepoints);
+        }
+    }
+#elif defined(__SSE2__)
+    __m128i zero = _mm_setzero_si128();
+    for (; i + 16 <= src_len; i += 16) {
+        __m128i bytes = _mm_loadu_si128((const __m128i *) &src[i]);
+        if (_mm_movemask_epi8(bytes) != 0) break;
+        __m128i lo = _mm_unpacklo_epi8(bytes, zero);
+        __m128i hi = _mm_unpackhi_epi8(bytes, zero);
+        _mm_storeu_si128((__m128i *) &dst[i + 0], _mm_unpacklo_epi16(lo, zero));
+        _mm_storeu_si128((__m128i *) &dst[i + 4], _mm_unpackhi_epi16(lo, zero));
+        _mm_storeu_si128((__m128i *) &dst[i + 8], _mm_unpacklo_epi16(hi, zero));
+        _mm_storeu_si128((__m128i *) &dst[i + 12], _mm_unpackhi_epi16(hi, zero));
+    }
+#endif
+    for (; i < src_len && (uint8_t) src[i] < 0x80; i++) dst[i] = src[i];
+    return i;
+}
+
+// Same as 'ascii_utf8_to_utf32' the other way
+static size_t ascii_utf32_to_utf8(const wchar_t *src, size_t src_len, char *dst)
+{
+    size_t i = 0;
+#if defined(__AVX2__)
+    __m256i non_ascii_mask = _mm256_set1_epi32(~0x7f);
+    __m256i byte_order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    for (; i + 32 <= src_len; i += 32) {
+        __m256i a = _mm256_loadu_si256((const __m256i *) &src[i + 0]);
+        __m256i b = _mm256_loadu_si256((const __m256i *) &src[i + 8]);
+        __m256i c = _mm256_loadu_si256((const __m256i *) &src[i + 16]);
+        __m256i d = _mm256_loadu_si256((const __m256i *) &src[i + 24]);
+        __m256i all = _mm256_or_si256(_mm256_or_si256(a, b), _mm256_or_si256(c, d));
+        if (!_mm256_testz_si256(all, non_ascii_mask)) break;
+        // Packing works inside 128 bit lanes, the permutation puts the quarters in order
+        __m256i bytes = _mm256_packus_epi16(_mm256_packs_epi32(a, b), _mm256_packs_epi32(c, d));
+        _mm256_storeu_si256((__m256i *) &dst[i], _mm256_permutevar8x32_epi32(bytes, byte_order));
+    }
+#elif defined(__SSE2__)
+    __m128i non_ascii_mask = _mm_set1_epi32(~0x7f);
+    __m128i zero = _mm_setzero_si128();
+    for (; i + 16 <= src_len; i += 16) {
+        __m128i a = _mm_loadu_si128((const __m128i *) &src[i + 0]);
+        __m128i b = _mm_loadu_si128((const __m128i *) &src[i + 4]);
+        __m128i c = _mm_loadu_si128((const __m128i *) &src[i + 8]);
+        __m128i d = _mm_loadu_si128((const __m128i *) &src[i + 12]);
+        __m128i all = _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d));
+        __m128i non_ascii = _mm_and_si128(all, non_ascii_mask);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(non_ascii, zero)) != 0xffff) break;
+        __m128i bytes = _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+        _mm_storeu_si128((__m128i *) &dst[i], bytes);
+    }
+#endif
+    for (; i < src_len && (uint32_t) src[i] < 0x80; i++) dst[i] = src[i];
+    return i;
+}
+
+template <typename Char>
+static TextUnit next_text_unit(const Char *text, size_t text_len)
+{
+    wchar_t codepoint;
+    size_t len = decode_codepoint(text, text_len, &codepoint);
+    int slot;
+    size_t emoji_len = match_emoji(text, text_len, &slot);
+    if (emoji_len > 0) return { emoji_len, slot, codepoint };
+    return { len, -1, codepoint };
+}
+
+// Same as 'next_text_unit' for the 'i'th code unit of a line, but emoji are
+// taken from the runs found by 'Lines::recalc'. 'run_idx' starts at
+// 'line.first_emoji_run' and is advanced past used runs
+template <typename Char>
+static TextUnit next_line_text_unit(common::BasicLines<Char> *lines, common::BasicLine<Char> line, size_t i, size_t *run_idx)
+{
+    wchar_t codepoint;
+    size_t len = decode_codepoint(&line.text[i], line.len - i, &codepoint);
+    size_t offset = &line.text[i] - lines->items[0].text;
+    if (*run_idx < lines->emoji_run_count && lines->emoji_runs[*run_idx].offset == offset) {
+        common::EmojiRun run = lines->emoji_runs[(*run_idx)++];
+        return { run.len, run.slot, codepoint };
+    }
+    return { len, -1, codepoint };
+}
+
+// Emoji are drawn as squares of the font size
+static float text_unit_width(FontId font_id, TextUnit unit)
+{
+    if (unit.emoji_slot >= 0) return g_font_data[font_id].size;
+    return get_glyph_width(font_id, unit.codepoint);
+}
+
+// Adds the sequence from the file name ('-' separated hex codepoints) to the trie
+static void index_emoji(const char *file_name, size_t slot)
+{
+    char *end;
+    wchar_t codepoint = (wchar_t) strtol(file_name, &end, 16);
+    assert((uint32_t) codepoint < UNICODE_CODEPOINT_COUNT);
+    uint8_t *page = &g_emoji_page_index[codepoint/EMOJI_PAGE_SIZE];
+    if (*page == 0) {
+        assert(g_emoji_page_count < EMOJI_PAGE_CAPACITY && "Increase 'EMOJI_PAGE_CAPACITY'");
+        *page = g_emoji_page_count++;
+    }
+
+    uint16_t *node = &g_emoji_pages[*page][codepoint%EMOJI_PAGE_SIZE];
+    for (;;) {
+        if (*node == 0) {
+            assert(g_emoji_trie_len < EMOJI_TRIE_CAPACITY && "Increase 'EMOJI_TRIE_CAPACITY'");
+            *node = g_emoji_trie_len++;
+            g_emoji_trie[*node] = { codepoint, -1, 0, 0 };
+        }
+
+        do {
+            if (*end != '-') {
+                g_emoji_trie[*node].slot = slot;
+                return;
+            }
+            codepoint = (wchar_t) strtol(end+1, &end, 16);
+        } while (codepoint == 0xfe0f);
+
+        // Find the child or the end of the sibling list to append it to
+        node = &g_emoji_trie[*node].first_child;
+        while (*node != 0 && g_emoji_trie[*node].codepoint != codepoint) {
+            node = &g_emoji_trie[*node].next_sibling;
+        }
+    }
+}
+
+static uint16_t emoji_trie_child(uint16_t node, wchar_t codepoint)
+{
+    for (node = g_emoji_trie[node].first_child; node != 0; node = g_emoji_trie[node].next_sibling) {
+        if (g_emoji_trie[node].codepoint == codepoint) return node;
+    }
+    return 0;
+}
+
+// Returns length in code units of the longest emoji sequence at the
+// beginning of the text (0 if there is none). Its slot goes to 'slot'
+template <typename Char>
+static size_t match_emoji(const Char *text, size_t text_len, int *slot)
+{
+    if (text_len == 0) return 0;
+    wchar_t codepoint;
+    size_t i = decode_codepoint(text, text_len, &codepoint);
+    if ((uint32_t) codepoint >= UNICODE_CODEPOINT_COUNT) return 0;
+    uint8_t page = g_emoji_page_index[codepoint/EMOJI_PAGE_SIZE];
+    uint16_t node = g_emoji_pages[page][codepoint%EMOJI_PAGE_SIZE];
+
+    size_t match_len = 0;
+    while (node != 0) {
+        // 'i' is past the codepoint of 'node' and 'next_len' is the length of the next one
+        size_t next_len = 0;
+        while (i < text_len) {
+            next_len = decode_codepoint(&text[i], text_len - i, &codepoint);
+            if (codepoint != 0xfe0f) break;
+            i += next_len;
+        }
+        if (g_emoji_trie[node].slot >= 0) {
+            match_len = i;
+            *slot = g_emoji_trie[node].slot;
+        }
+        if (i >= text_len) break;
+        node = emoji_trie_child(node, codepoint);
+        i += next_len;
+    }
+
+    return match_len;
+}
+
+static Rectangle emoji_atlas_cell(EmojiAtlas *atlas, size_t slot)
+{
+    return {
+        (float) (slot%EMOJI_ATLAS_COLUMNS * atlas->cell_size),
+        (float) (slot/EMOJI_ATLAS_COLUMNS * atlas->cell_size),
+        (float) atlas->cell_size,
+        (float) atlas->cell_size,
+    };
+}
+
+static void decode_emoji(size_t slot, Image resized[EMOJI_SIZE_COUNT])
+{
+    char path[] = EMOJI_DIR_PATH"/00000000000000000000000000000000.png";
+    assert(strlen(g_emoji_file_names[slot]) < sizeof(path) - sizeof(EMOJI_DIR_PATH));
+    strcpy(&path[sizeof(EMOJI_DIR_PATH)], g_emoji_file_names[slot]);
+
+    Image img = LoadImage(path);
+    ImageFormat(&img, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    for (size_t i = 0; i < EMOJI_SIZE_COUNT; i++) {
+        resized[i] = ImageCopy(img);
+        ImageResize(&resized[i], g_emoji_sizes[i], g_emoji_sizes[i]);
+    }
+    UnloadImage(img);
+}
+
+static EmojiCacheHeader emoji_cache_header()
+{
+    EmojiCacheHeader header = {};
+    memcpy(header.magic, EMOJI_CACHE_MAGIC, sizeof(header.magic));
+    header.version = EMOJI_CACHE_VERSION;
+    header.emoji_count = g_emoji_count;
+    header.size_count = EMOJI_SIZE_COUNT;
+    header.atlas_columns = EMOJI_ATLAS_COLUMNS;
+
+    struct stat st;
+    if (stat(EMOJI_DIR_PATH, &st) == 0) header.dir_mtime = st.st_mtime;
+
+    // FNV-1a
+    uint64_t hash = 0xcbf29ce484222325;
+    char path[] = EMOJI_DIR_PATH"/00000000000000000000000000000000.png";
+    for (size_t slot = 0; slot < g_emoji_count; slot++) {
+        strcpy(&path[sizeof(EMOJI_DIR_PATH)], g_emoji_file_names[slot]);
+        int64_t file_info[2] = {};
+        if (stat(path, &st) == 0) {
+            file_info[0] = st.st_size;
+            file_info[1] = st.st_mtime;
+        }
+
+        for (const char *c = g_emoji_file_names[slot]; *c != '\0'; c++) {
+            hash = (hash ^ (uint8_t) *c) * 0x100000001b3;
+        }
+        for (size_t i = 0; i < sizeof(file_info); i++) {
+            hash = (hash ^ ((uint8_t *) file_info)[i]) * 0x100000001b3;
+        }
+    }
+    header.dir_hash = hash;
+
+    return header;
+}
+
+static bool load_emoji_cache(EmojiCacheHeader expected)
+{
+    int fd = open(g_emoji_cache_path, O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat st;
+    if (fstat(fd, &st) < 0 || (size_t) st.st_size < sizeof(EmojiCacheHeader)) {
+        close(fd);
+        return false;
+    }
+
+    void *data = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED) return false;
+
+    // Validate the cache
+    size_t atlas_rows = (g_emoji_count + EMOJI_ATLAS_COLUMNS - 1)/EMOJI_ATLAS_COLUMNS;
+    size_t expected_size = sizeof(EmojiCacheHeader) +
+        EMOJI_SIZE_COUNT*sizeof(int32_t) + g_emoji_count*sizeof(uint32_t);
+    for (size_t i = 0; i < EMOJI_SIZE_COUNT; i++) {
+        expected_size += EMOJI_ATLAS_COLUMNS*atlas_rows*g_emoji_sizes[i]*g_emoji_sizes[i]*sizeof(Color);
+    }
+
+    uint8_t *ptr = (uint8_t *) data;
+    const int32_t *sizes = (const int32_t *) &ptr[sizeof(EmojiCacheHeader)];
+    const uint32_t *codes = (const uint32_t *) &sizes[EMOJI_SIZE_COUNT];
+    bool is_valid =
+        (size_t) st.st_size == expected_size &&
+        memcmp(data, &expected, sizeof(EmojiCacheHeader)) == 0 &&
+        memcmp(sizes, g_emoji_sizes, sizeof(g_emoji_sizes)) == 0;
+    for (size_t slot = 0; is_valid && slot < g_emoji_count; slot++) {
+        is_valid = codes[slot] == (uint32_t) g_emoji_codes[slot];
+    }
+
+    if (!is_valid) {
+        munmap(data, st.st_size);
+        return false;
+    }
+
+    // Upload atlases directly from the mapped file
+    ptr = (uint8_t *) &codes[g_emoji_count];
+    for (size_t i = 0; i < EMOJI_SIZE_COUNT; i++) {
+        Image atlas_img = {
+            ptr,
+            EMOJI_ATLAS_COLUMNS*g_emoji_sizes[i],
+            (int) atlas_rows*g_emoji_sizes[i],
+            1,
+            PIXELFORMAT_UNCOMPRESSED_R8G8B8A8,
+        };
+        g_emoji_atlases[i].cell_size = g_emoji_sizes[i];
+        g_emoji_atlases[i].texture = LoadTextureFromImage(atlas_img);
+        ptr += atlas_img.width*atlas_img.height*sizeof(Color);
+    }
+    munmap(data, st.st_size);
+
+    memset(g_emoji_states, EMOJI_STATE_LOADED, g_emoji_count);
+    return true;
+}
+
+static void pack_emoji(size_t slot, Image atlas_imgs[EMOJI_SIZE_COUNT])
+{
+    Image resized[EMOJI_SIZE_COUNT];
+    decode_emoji(slot, resized);
+    for (size_t i = 0; i < EMOJI_SIZE_COUNT; i++) {
+        // Copy rows directly: the cell is empty so there is nothing to blend with
+        int cell_size = g_emoji_atlases[i].cell_size;
+        Rectangle cell = emoji_atlas_cell(&g_emoji_atlases[i], slot);
+        Color *dst = &((Color *) atlas_imgs[i].data)[(int) cell.y*atlas_imgs[i].width + (int) cell.x];
+        for (int row = 0; row < cell_size; row++) {
+            memcpy(&dst[row*atlas_imgs[i].width],
+                   &((Color *) resized[i].data)[row*cell_size],
+                   cell_size*sizeof(Color));
+        }
+        UnloadImage(resized[i]);
+    }
+}
+
+// Decodes and resizes emoji on 'thread_count' threads, the caller is one of
+// them. Cells of different slots don't overlap, so workers write into the
+// atlas images without locking
+static void pack_all_emoji(Image atlas_imgs[EMOJI_SIZE_COUNT], unsigned thread_count)
+{
+    auto pack_emoji_worker = [=]() {
+        for (size_t slot; (slot = claim_emoji_slot()) < g_emoji_count;) {
+            pack_emoji(slot, atlas_imgs);
+#ifdef EMOJI_LAZY_LOADING
+            g_are_emoji_packed[slot] = true;
+#endif
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (unsigned i = 1; i < thread_count; i++) {
+        workers.emplace_back(pack_emoji_worker);
+    }
+    pack_emoji_worker();
+    for (std::thread &worker : workers) worker.join();
+}
+
+// Requested slots go first, the rest in order. Returns 'g_emoji_count' when
+// every slot is claimed
+static size_t claim_emoji_slot()
+{
+#ifdef EMOJI_LAZY_LOADING
+    if (g_is_emoji_build_stopped) return g_emoji_count;
+    {
+        std::lock_guard<std::mutex> lock(g_emoji_request_mutex);
+        while (g_emoji_request_count > 0) {
+            size_t slot = g_emoji_requests[--g_emoji_request_count];
+            if (!g_are_emoji_claimed[slot].exchange(true)) return slot;
+        }
+    }
+#endif
+
+    for (;;) {
+        size_t slot = g_next_emoji_slot++;
+        if (slot >= g_emoji_count) return g_emoji_count;
+        if (!g_are_emoji_claimed[slot].exchange(true)) return slot;
+    }
+}
+
+static void save_emoji_cache(EmojiCacheHeader header, Image atlas_imgs[EMOJI_SIZE_COUNT])
+{
+    // Write to a temporary file first so a half-written cache is never loaded
+    char tmp_path[EMOJI_CACHE_PATH_CAPACITY + 4];
+    snprintf(tmp_path, sizeof(tmp_path), "%s.tmp", g_emoji_cache_path);
+    FILE *f = fopen(tmp_path, "wb");
+    if (f == nullptr) {
+        fprintf(stderr, "WARNING: Could not write emoji cache '%s'\n", g_emoji_cache_path);
+        return;
+    }
+
+    uint32_t codes[EMOJI_COUNT];
+    for (size_t slot = 0; slot < g_emoji_count; slot++) codes[slot] = g_emoji_codes[slot];
+
+    bool ok = fwrite(&header, sizeof(header), 1, f) == 1 &&
+              fwrite(g_emoji_sizes, sizeof(g_emoji_sizes), 1, f) == 1 &&
+              fwrite(codes, sizeof(uint32_t), g_emoji_count, f) == g_emoji_count;
+    for (size_t i = 0; ok && i < EMOJI_SIZE_COUNT; i++) {
+        size_t size = atlas_imgs[i].width*atlas_imgs[i].height*sizeof(Color);
+        ok = fwrite(atlas_imgs[i].data, size, 1, f) == 1;
+    }
+
+    if (fclose(f) != 0 || !ok || rename(tmp_path, g_emoji_cache_path) != 0) {
+        fprintf(stderr, "WARNING: Could not write emoji cache '%s'\n", g_emoji_cache_path);
+        remove(tmp_path);
+    }
+}
+
+#ifdef EMOJI_LAZY_LOADING
+// Runs on its own thread, so it touches only 'g_built_emoji_imgs'. Emoji
+// states belong to the main thread. One core is left to the main thread
+static void build_emoji_cache(EmojiCacheHeader header)
+{
+    unsigned thread_count = std::thread::hardware_concurrency();
+    pack_all_emoji(g_built_emoji_imgs, thread_count > 1 ? thread_count - 1 : 1);
+    if (g_is_emoji_build_stopped) return;
+    save_emoji_cache(header, g_built_emoji_imgs);
+    g_are_emoji_built = true;
+}
+
+// Replaces the atlases filled by 'upload_packed_emoji' with the built ones at once
+static void upload_built_emoji()
+{
+    for (size_t i = 0; i < EMOJI_SIZE_COUNT; i++) {
+        UpdateTexture(g_emoji_atlases[i].texture, g_built_emoji_imgs[i].data);
+        UnloadImage(g_built_emoji_imgs[i]);
+        g_built_emoji_imgs[i] = {};
+    }
+    memset(g_emoji_states, EMOJI_STATE_LOADED, g_emoji_count);
+    g_emoji_load_queue_len = 0;
+    g_are_emoji_built = false;
+}
+
+// Copies the cells of a slot the builder has packed into the uploaded atlases
+static void upload_packed_emoji(size_t slot)
+{
+    for (size_t i = 0; i < EMOJI_SIZE_COUNT; i++) {
+        Rectangle cell = emoji_atlas_cell(&g_emoji_atlases[i], slot);
+        Image cell_img = ImageFromImage(g_built_emoji_imgs[i], cell);
+        UpdateTextureRec(g_emoji_atlases[i].texture, cell, cell_img.data);
+        UnloadImage(cell_img);
+    }
+
+    g_emoji_states[slot] = EMOJI_STATE_LOADED;
+}
+#endif
+
+// Sequences with the same first codepoint are ordered by the whole name
+static int compare_emoji_file_names(const void *a, const void *b)
+{
+    long code_a = strtol(*(char * const *) a, NULL, 16);
+    long code_b = strtol(*(char * const *) b, NULL, 16);
+    if (code_a != code_b) return (code_a > code_b) - (code_a < code_b);
+    return strcmp(*(char * const *) a, *(char * const *) b);
+}
+
+// Only lazy loading has emoji that are not loaded. The builder is asked to
+// pack the slot next, 'common::update' uploads it then
+static void request_emoji(size_t slot)
+{
+    g_emoji_states[slot] = EMOJI_STATE_REQUESTED;
+    g_emoji_load_queue[g_emoji_load_queue_len++] = slot;
+#ifdef EMOJI_LAZY_LOADING
+    std::lock_guard<std::mutex> lock(g_emoji_request_mutex);
+    g_emoji_requests[g_emoji_request_count++] = slot;
+#endif
+}
+
+// Consecutive emoji share the atlas texture so raylib keeps them in one batch.
+// Emoji that are not loaded yet are requested and drawn as a placeholder
+static void draw_emoji(FontId font_id, int slot, Vector2 pos)
+{
+    assert(slot >= 0 && (size_t) slot < g_emoji_count && "Unknown emoji");
+
+    EmojiAtlas *atlas = &g_emoji_atlases[g_font_data[font_id].emoji_size];
+    Rectangle cell = emoji_atlas_cell(atlas, slot);
+    if (g_emoji_states[slot] != EMOJI_STATE_LOADED) {
+        if (g_emoji_states[slot] == EMOJI_STATE_UNLOADED) request_emoji(slot);
+
+        DrawRectangleRounded(
+                { pos.x, pos.y, cell.width, cell.height },
+                EMOJI_PLACEHOLDER_ROUNDNESS, EMOJI_PLACEHOLDER_SEGMENT_COUNT,
+                EMOJI_PLACEHOLDER_COLOR);
+        return;
+    }
+
+    DrawTexturePro(atlas->texture, cell,
+            { pos.x, pos.y, cell.width, cell.height },
+            { 0, 0 }, 0, WHITE);
+}
+
+template struct common::BasicLines<wchar_t>;
+template struct common::BasicLines<char>;
+template void common::draw_text_in_width(FontId, Vector2, const wchar_t *, size_t, Color, float);
+template void common::draw_text_in_width(FontId, Vector2, const char *, size_t, Color, float);
+template void common::draw_lines(FontId, Vector2, common::BasicLines<wchar_t> *, Color);
+template void common::draw_lines(FontId, Vector2, common::BasicLines<char> *, Color);
+template float common::measure_text_in_width(FontId, const wchar_t *, size_t, float);
+template float common::measure_text_in_width(FontId, const char *, size_t, float);
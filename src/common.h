@@ -2,35 +2,131 @@
 #define COMMON_H
 
 #include <cstddef>
+#include <cstdint>
 
 #include "config.h"
 
 #include <raylib.h>
 
 namespace common {
-    struct Line {
-        wchar_t *text;
-        size_t len;
-        size_t trim_whitespace_count;
+    // Line breaking (UAX #14) state before a text unit. Zeroed is the start of a text
+    struct LineBreakState {
+        uint8_t cls; // Class of the last unit that was not a space
+        bool after_space;
     };
 
-    struct Lines {
-        Line *items;
-        size_t len;
-        size_t cap;
+    // Offsets and lengths of lines, runs and words are in code units of 'Char'.
+    // Lines are kept for every message, so they are 32-bit
+    template <typename Char>
+    struct BasicLine {
+        Char *text;
+        uint32_t len;
+        uint32_t trim_whitespace_count;
+        uint32_t first_emoji_run; // First of 'Lines::emoji_runs' inside or after the line
+        LineBreakState break_state; // Before the first unit, so 'rewrap' can start from the line
+        float width; // Without the trimmed spaces. Set by the wrapping
+    };
+
+    // Emoji sequence found in the text by 'Lines::recalc'
+    struct EmojiRun {
+        uint32_t offset; // From the beginning of the text
+        uint32_t len;
+        int slot;
+    };
+
+    // Text up to the next line break opportunity without the spaces and
+    // maybe a line feed after it. Found by 'Lines::analyse'. Words are kept
+    // for every message, so 'wrap' finds the spaces again and the next word
+    // starts after them
+    struct Word {
+        uint32_t end;
+        float width;
+    };
+
+    struct ArenaBlock;
+
+    // Bump allocator for memory that is released all at once. 'reset' keeps
+    // the blocks, so a warm arena allocates nothing
+    struct Arena {
+        ArenaBlock *first;
+        ArenaBlock *curr;
 
+        void *alloc(size_t size);
+        void  reset();
+        void  unload();
+    };
+
+    struct TextBatch;
+
+    // Capacity grows geometrically and is kept by 'clear' and 'recalc'. Every
+    // message has lines, so counts are 32-bit
+    template <typename Char>
+    struct BasicLines {
+        BasicLine<Char> *items;
+        uint32_t len;
+        uint32_t cap;
+        EmojiRun *emoji_runs; // Sorted by offset
+        uint32_t emoji_run_count;
+        uint32_t emoji_run_cap;
+        TextBatch *batch; // Glyph quads built by 'draw_lines', dropped when the lines change
+
+        Char *text;
+        uint32_t text_len;
+        // Pen position before every code unit and after the last one, lines
+        // start anywhere. Only 'recalc' and 'rewrap' fill it
+        uint32_t xs_cap;
+        float *xs;
+
+        // Words found by 'analyse', so 'wrap' does not measure the text again
+        Word *words;
+        uint32_t word_count;
+        uint32_t word_cap;
+
+        void    clear();
+        void    unload();
         void    grow_one();
-        float   max_line_width(FontId font_id);
-        void    recalc(FontId font_id, wchar_t *text, size_t text_len, float max_line_width);
+        float   max_line_width();
+        void    recalc(FontId font_id, Char *text, size_t text_len, float max_line_width);
+        // Same as 'recalc' after 'text' was changed in [edit_begin, edit_end)
+        // and its length changed by 'delta'
+        void    rewrap(FontId font_id, Char *text, size_t text_len, float max_line_width,
+                       size_t edit_begin, size_t edit_end, ptrdiff_t delta);
         Vector2 get_vec_to_pos(FontId font_id, size_t row, size_t col);
+        void    find_pos(const Char *ptr, size_t *row, size_t *col);
+        size_t  col_at_x(size_t row, float x);
+        // 'recalc' split in two for text that is not edited: find the words
+        // and their widths, then wrap them to any width without measuring
+        // again. There are no 'xs', so no 'get_vec_to_pos' and 'col_at_x'
+        void    analyse(FontId font_id, Char *text, size_t text_len);
+        void    wrap(FontId font_id, float max_line_width); // With the font of 'analyse'
     };
 
+    // The text editor works on UTF-32, messages keep the UTF-8 they come in
+    typedef BasicLine<wchar_t>  Line;
+    typedef BasicLines<wchar_t> Lines;
+    typedef BasicLine<char>     Utf8Line;
+    typedef BasicLines<char>    Utf8Lines;
+
     void  init();
-    void  draw_text_in_width(FontId font_id, Vector2 pos, const wchar_t *text, size_t text_len, Color color, float in_width);
-    void  draw_lines(FontId font_id, Vector2 pos, Lines lines, Color color);
+    void  deinit(); // Before 'CloseWindow'
+    void  update();
+    // Templates below are defined for 'wchar_t' (UTF-32) and 'char' (UTF-8)
+    template <typename Char>
+    void  draw_text_in_width(FontId font_id, Vector2 pos, const Char *text, size_t text_len, Color color, float in_width);
+    // Glyphs of 'draw_lines' are queued and drawn by 'flush_text' over
+    // everything drawn before the flush
+    template <typename Char>
+    void  draw_lines(FontId font_id, Vector2 pos, BasicLines<Char> *lines, Color color);
+    void  flush_text();
     void  draw_wtext(FontId font_id, Vector2 pos, const wchar_t *wtext, size_t wtext_len, Color color);
     float font_size(FontId font_id);
     float measure_wtext(FontId font_id, const wchar_t *text, size_t text_len); // Function like 'MeasureText' but for 'wchar_t *'
+    template <typename Char>
+    float measure_text_in_width(FontId font_id, const Char *text, size_t text_len, float max_width); // Stops at 'max_width' and returns it
+    // Return the length written to 'dst', which has room for 'src_len'
+    // codepoints or '4*src_len' bytes. Invalid input becomes U+FFFD
+    size_t utf8_to_utf32(const char *src, size_t src_len, wchar_t *dst);
+    size_t utf32_to_utf8(const wchar_t *src, size_t src_len, char *dst);
 }
 
 #endif
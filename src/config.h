@@ -6,17 +6,33 @@
 #define DEFAULT_WIDTH  800
 #define DEFAULT_HEIGHT 600
 
-#define FONT_GLYPH_COUNT 30000
-
 #define CHAT_VIEW_WIDTH   950.0f
 #define CHAT_BG_COLOR     CLITERAL(Color){0x12, 0x12, 0x12, 0xff}
-#define CHAT_SCROLL_SPEED 100
+#define CHAT_SCROLL_SPEED 100   // Pixels of one mouse wheel step
+#define CHAT_SCROLL_EASING 0.25f // Part of the distance to the scroll target covered every 1/120 of a second
+#define CHAT_LAYOUT_TIME_PER_FRAME 0.004 // Seconds spent on laying out messages that are not visible
+#define CHAT_MESSAGES_MEMORY_CAP   (256*1024*1024) // Bytes of loaded messages, over it older pages are not fetched and new messages drop the oldest
+#define CHAT_HISTORY_PREFETCH_SCREENS 3 // Older messages are requested when the view is this close to the oldest loaded one
 
 // NOTE: Specify integer not float (e.g. X(28) not X(28.0f))
 #define LIST_OF_EMOJI_SIZES \
     X(28) \
     X(25) \
 
+// Decode emoji when they are drawn for the first time instead of at startup.
+// In both modes the decoded emoji are saved to a cache that makes the next
+// startups fast. With lazy loading it is built in the background
+#define EMOJI_LAZY_LOADING
+#define EMOJI_LOADS_PER_FRAME            16
+#define EMOJI_PLACEHOLDER_COLOR          CLITERAL(Color){0x40, 0x40, 0x40, 0xff}
+#define EMOJI_PLACEHOLDER_ROUNDNESS      0.5f
+#define EMOJI_PLACEHOLDER_SEGMENT_COUNT  8
+
+// Render text from signed distance fields: one glyph atlas per font file
+// serves every size in 'LIST_OF_FONTS'
+#define SDF_FONTS
+#define SDF_FONT_BASE_SIZE 48
+
 #define LIST_OF_FONTS \
     X(ROBOTO_REGULAR_28, "resources/Roboto-Regular.ttf", 28.0f, EMOJI_SIZE_28) \
     X(ROBOTO_BOLD_28, "resources/Roboto-Bold.ttf", 28.0f, EMOJI_SIZE_28) \
@@ -110,6 +126,8 @@ const struct {
 #   define KEYMAP_NEW_LINE           (IsKeyDown(KEY_LEFT_CONTROL) && IsKeyDown(KEY_LEFT_SHIFT) && IsKeyPressed(KEY_J))
 #   define KEYMAP_SELECT_PREV        (IsKeyDown(KEY_LEFT_CONTROL) && IsKeyDown(KEY_LEFT_SHIFT) && IsKeyPressed(KEY_P))
 #   define KEYMAP_SELECT_NEXT        (IsKeyDown(KEY_LEFT_CONTROL) && IsKeyDown(KEY_LEFT_SHIFT) && IsKeyPressed(KEY_N))
+#   define KEYMAP_SCROLL_UP          (IsKeyDown(KEY_LEFT_ALT)     && KEY(V))
+#   define KEYMAP_SCROLL_DOWN        (IsKeyDown(KEY_LEFT_CONTROL) && KEY(V))
 #else
 #   define KEYMAP_MOVE_FORWARD       (KEY(RIGHT))
 #   define KEYMAP_MOVE_BACKWARD      (KEY(LEFT))
@@ -126,6 +144,8 @@ const struct {
 #   define KEYMAP_NEW_LINE           (IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_ENTER))
 #   define KEYMAP_SELECT_PREV        (IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_UP))
 #   define KEYMAP_SELECT_NEXT        (IsKeyDown(KEY_LEFT_CONTROL) && IsKeyPressed(KEY_DOWN))
+#   define KEYMAP_SCROLL_UP          (KEY(PAGE_UP))
+#   define KEYMAP_SCROLL_DOWN        (KEY(PAGE_DOWN))
 #endif
 
 #endif
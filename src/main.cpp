@@ -17,6 +17,7 @@ int main()
     while (!WindowShouldClose()) {
         tgclient::update();
         chat::update();
+        common::update();
 
         BeginDrawing();
             ClearBackground(CHAT_BG_COLOR);
@@ -24,11 +25,11 @@ int main()
         EndDrawing();
     }
 
+    common::deinit();
     CloseWindow();
     return 0;
 }
 
 // TODO: Chat panel
-// TODO: Recalculating messages only on window resize
 // TODO: A way to write emoji
 // TODO: Add new messages widgets (time, is message read)
@@ -1,11 +1,13 @@
 #include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <wchar.h>
 #include <iostream>
 #include <map>
-#include <codecvt>
-#include <locale>
 
 #include "tgclient.h"
 #include "chat.h"
+#include "common.h"
 
 #define TG_CLIENT_WAIT_TIME 0.0f
 
@@ -14,6 +16,8 @@
 
 #define REQUEST_ANSWER_HANDLERS_CAPACITY 16
 
+#define NAMES_INIT_CAPACITY 1024 // Power of two
+
 #define LIST_OF_PRIVATE_UPDATE_HANDLERS \
     X(updateAuthorizationState, update_auth_state) \
     X(authorizationStateWaitTdlibParameters, auth_state_wait_tdlib_params) \
@@ -32,14 +36,45 @@
 LIST_OF_PRIVATE_UPDATE_HANDLERS
 #undef X
 
+// Interned string, the characters are in 'name_arena' and never move
+struct Name {
+    const wchar_t *text;
+    size_t len;
+};
+
+// Open addressing from a user or chat id to a name handle. It is kept at
+// most half full
+struct NameMap {
+    std::int64_t *ids;
+    tgclient::NameHandle *handles; // Zero is an empty slot
+    size_t len;
+    size_t cap;
+};
+
+static tgclient::NameHandle find_name_handle(NameMap *map, std::int64_t id, const wchar_t *unknown_name);
+static void set_name(NameMap *map, std::int64_t id, const std::string &utf8);
+static std::uint32_t intern_name(const wchar_t *text, size_t len);
+static size_t id_slot(std::int64_t id, size_t cap);
+static size_t name_slot(const wchar_t *text, size_t len, size_t cap);
+static void *grow(void *items, size_t size);
+
 tgclient::State tgclient::state = tgclient::STATE_NONE;
 
 static td::ClientManager manager;
 static std::int32_t      client_id;
 static tgclient::Handler request_answer_handlers[REQUEST_ANSWER_HANDLERS_CAPACITY];
-static std::map<std::int64_t, std::wstring> users;
-static std::map<std::int64_t, std::wstring> chat_titles;
-static std::wstring_convert<std::codecvt_utf8<wchar_t>> converter;
+static NameMap           users;
+static NameMap           chat_titles;
+static common::Arena     name_arena;
+static Name             *names;        // Every name once
+static size_t            name_count;
+static size_t            name_cap;
+static std::uint32_t    *name_set;     // Indices of 'names' + 1 by hash of the text, zero is an empty slot
+static size_t            name_set_cap; // Twice 'name_cap'
+static std::uint32_t    *handle_names; // Index of 'names' for every handle. Handle 0 is not used
+static size_t            handle_count;
+static size_t            handle_cap;
+static std::uint32_t     name_gen;     // See 'tgclient::name_generation'
 static std::map<std::int64_t, void*> update_handlers = {
 #define X(update_type, handler) { td_api::update_type::ID, (void *) handler },
     LIST_OF_PRIVATE_UPDATE_HANDLERS
@@ -116,20 +151,27 @@ void tgclient::request(td_api::object_ptr<td_api::Function> req)
     manager.send(client_id, SILENT_REQUEST_ID, std::move(req));
 }
 
-std::wstring_view tgclient::username(std::int64_t user_id)
+// Ids that are not known yet get a handle too, it shows the name once it comes
+tgclient::NameHandle tgclient::username(std::int64_t user_id)
+{
+    return find_name_handle(&users, user_id, L"Unknown user");
+}
+
+tgclient::NameHandle tgclient::chat_title(std::int64_t chat_id)
+{
+    return find_name_handle(&chat_titles, chat_id, L"Unknown chat");
+}
+
+std::wstring_view tgclient::name(NameHandle handle)
 {
-    auto it = users.find(user_id);
-    return it == users.end() ?
-           std::wstring_view(L"Unknown user") :
-           std::wstring_view(it->second);
+    assert(handle != 0 && handle < handle_count);
+    Name name = names[handle_names[handle]];
+    return std::wstring_view(name.text, name.len);
 }
 
-std::wstring_view tgclient::chat_title(std::int64_t chat_id)
+std::uint32_t tgclient::name_generation()
 {
-    auto it = chat_titles.find(chat_id);
-    return it == chat_titles.end() ?
-           std::wstring_view(L"Unknown chat") :
-           std::wstring_view(it->second);
+    return name_gen;
 }
 
 // PRIVATE FUNCTION IMPLEMENTATIONS
@@ -178,14 +220,122 @@ static void auth_state_wait_code(td_api::object_ptr<td_api::authorizationStateWa
 
 static void update_user(td_api::object_ptr<td_api::updateUser> update_user)
 {
-    auto user_id = update_user->user_->id_;
-    users.insert({user_id, converter.from_bytes(update_user->user_->first_name_)});
+    set_name(&users, update_user->user_->id_, update_user->user_->first_name_);
 }
 
 static void update_new_chat(td_api::object_ptr<td_api::updateNewChat> update_new_chat)
 {
-    chat_titles.insert({
-        update_new_chat->chat_->id_,
-        converter.from_bytes(update_new_chat->chat_->title_)
-    });
+    set_name(&chat_titles, update_new_chat->chat_->id_, update_new_chat->chat_->title_);
+}
+
+static tgclient::NameHandle find_name_handle(NameMap *map, std::int64_t id, const wchar_t *unknown_name)
+{
+    if (2*(map->len + 1) > map->cap) {
+        NameMap old = *map;
+        map->cap = old.cap == 0 ? NAMES_INIT_CAPACITY : 2*old.cap;
+        map->ids = (std::int64_t *) calloc(map->cap, sizeof(std::int64_t));
+        map->handles = (tgclient::NameHandle *) calloc(map->cap, sizeof(tgclient::NameHandle));
+        if (map->ids == nullptr || map->handles == nullptr) {
+            fprintf(stderr, "ERROR: Could not allocate name map: no memory\n");
+            exit(1);
+        }
+        for (size_t i = 0; i < old.cap; i++) {
+            if (old.handles[i] == 0) continue;
+            size_t slot = id_slot(old.ids[i], map->cap);
+            while (map->handles[slot] != 0) slot = (slot + 1) & (map->cap - 1);
+            map->ids[slot] = old.ids[i];
+            map->handles[slot] = old.handles[i];
+        }
+        free(old.ids);
+        free(old.handles);
+    }
+
+    size_t slot = id_slot(id, map->cap);
+    while (map->handles[slot] != 0) {
+        if (map->ids[slot] == id) return map->handles[slot];
+        slot = (slot + 1) & (map->cap - 1);
+    }
+
+    if (handle_count == 0) handle_count = 1;
+    if (handle_count >= handle_cap) {
+        handle_cap = handle_cap == 0 ? NAMES_INIT_CAPACITY : 2*handle_cap;
+        handle_names = (std::uint32_t *) grow(handle_names, handle_cap*sizeof(std::uint32_t));
+    }
+    handle_names[handle_count] = intern_name(unknown_name, wcslen(unknown_name));
+    map->ids[slot] = id;
+    map->handles[slot] = handle_count;
+    map->len += 1;
+    return handle_count++;
+}
+
+// Renames point the handle at the new name. The old one stays in the arena.
+// A handle that is new here was not shown yet, so only older ones change
+// the generation
+static void set_name(NameMap *map, std::int64_t id, const std::string &utf8)
+{
+    static std::wstring text;
+    text.resize(utf8.size());
+    size_t len = common::utf8_to_utf32(utf8.data(), utf8.size(), &text[0]);
+    size_t old_handle_count = handle_count;
+    tgclient::NameHandle handle = find_name_handle(map, id, L"");
+    std::uint32_t name = intern_name(text.data(), len);
+    if (handle < old_handle_count && handle_names[handle] != name) name_gen += 1;
+    handle_names[handle] = name;
+}
+
+static std::uint32_t intern_name(const wchar_t *text, size_t len)
+{
+    if (2*(name_count + 1) > name_set_cap) {
+        name_cap = name_cap == 0 ? NAMES_INIT_CAPACITY : 2*name_cap;
+        names = (Name *) grow(names, name_cap*sizeof(Name));
+        name_set_cap = 2*name_cap;
+        free(name_set);
+        name_set = (std::uint32_t *) calloc(name_set_cap, sizeof(std::uint32_t));
+        if (name_set == nullptr) {
+            fprintf(stderr, "ERROR: Could not allocate name set: no memory\n");
+            exit(1);
+        }
+        for (size_t i = 0; i < name_count; i++) {
+            size_t slot = name_slot(names[i].text, names[i].len, name_set_cap);
+            while (name_set[slot] != 0) slot = (slot + 1) & (name_set_cap - 1);
+            name_set[slot] = i + 1;
+        }
+    }
+
+    size_t slot = name_slot(text, len, name_set_cap);
+    while (name_set[slot] != 0) {
+        Name name = names[name_set[slot] - 1];
+        if (name.len == len && wmemcmp(name.text, text, len) == 0) return name_set[slot] - 1;
+        slot = (slot + 1) & (name_set_cap - 1);
+    }
+
+    wchar_t *name_text = (wchar_t *) name_arena.alloc(len*sizeof(wchar_t));
+    wmemcpy(name_text, text, len);
+    names[name_count] = { name_text, len };
+    name_set[slot] = name_count + 1;
+    return name_count++;
+}
+
+// Fibonacci hashing, ids are often sequential
+static size_t id_slot(std::int64_t id, size_t cap)
+{
+    return ((std::uint64_t) id*0x9e3779b97f4a7c15 >> 32) & (cap - 1);
+}
+
+// FNV-1a
+static size_t name_slot(const wchar_t *text, size_t len, size_t cap)
+{
+    std::uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < len; i++) hash = (hash ^ (std::uint32_t) text[i])*16777619u;
+    return hash & (cap - 1);
+}
+
+static void *grow(void *items, size_t size)
+{
+    void *result = realloc(items, size);
+    if (result == nullptr) {
+        fprintf(stderr, "ERROR: Could not allocate names: no memory\n");
+        exit(1);
+    }
+    return result;
 }
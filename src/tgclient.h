@@ -14,6 +14,10 @@ namespace tgclient {
 
     typedef void (*Handler)(td_api::object_ptr<td_api::Object>);
 
+    // Stable handle of a user name or a chat title. It shows the new name
+    // after a rename
+    typedef std::uint32_t NameHandle;
+
     extern State state;
 
     void init();
@@ -21,8 +25,10 @@ namespace tgclient {
     void process_update(td_api::object_ptr<td_api::Object> obj);
     void request(td_api::object_ptr<td_api::Function> req, Handler handler);
     void request(td_api::object_ptr<td_api::Function> req);
-    std::wstring_view username(std::int64_t user_id);
-    std::wstring_view chat_title(std::int64_t chat_id);
+    NameHandle username(std::int64_t user_id);
+    NameHandle chat_title(std::int64_t chat_id);
+    std::wstring_view name(NameHandle handle); // Valid until the program exits
+    std::uint32_t name_generation(); // Changes when a handle shows another name
 
     template<typename T>
     void request(td_api::object_ptr<td_api::Function> req, void (*handler)(td_api::object_ptr<T>)) {
@@ -0,0 +1,174 @@
+#!/usr/bin/env perl
+# Generates src/line_break.h: line break classes of UAX #14 as a two-stage
+# table and the pair table of the rules LB7-LB30b.
+#
+#   perl tools/gen_line_break.pl > src/line_break.h
+#
+# Classes come from the Line_Break property of the Unicode data bundled with
+# Perl, so the version follows the Perl that runs the script.
+
+use strict;
+use warnings;
+use Unicode::UCD qw(prop_invmap);
+
+my $BLOCK_SHIFT = 7;
+my $BLOCK_SIZE = 1 << $BLOCK_SHIFT;
+my $CODEPOINT_COUNT = 0x110000;
+
+# Pair table classes go first, SP and BK are handled by the caller. WJ is
+# zero, so a zeroed state is the state at the start of a text
+my @classes = qw(WJ OP CL CP QU GL NS EX SY IS PR PO NU AL HL ID IN HY BA BB
+                 B2 ZW CM H2 H3 JL JV JT RI EB EM ZWJ SP BK);
+my $pair_class_count = @classes - 2;
+my %class_index;
+$class_index{$classes[$_]} = $_ for 0..$#classes;
+
+# LB1 without a dictionary for SA and with CJ as NS like the strict mode of CSS
+my ($gc_ranges, $gc_map) = prop_invmap('General_Category');
+my ($lb_ranges, $lb_map, undef, $lb_default) = prop_invmap('Line_Break');
+my @gc = expand($gc_ranges, $gc_map);
+my @lb = expand($lb_ranges, $lb_map);
+my @class_of;
+for my $cp (0..$CODEPOINT_COUNT-1) {
+    my $lb = $lb[$cp];
+    $lb = 'XX' if $lb eq $lb_default;
+    if    ($lb =~ /^(AI|SG|XX)$/)   { $lb = 'AL' }
+    elsif ($lb eq 'SA')             { $lb = $gc[$cp] =~ /^(Mn|Mc)$/ ? 'CM' : 'AL' }
+    elsif ($lb eq 'CJ')             { $lb = 'NS' }
+    elsif ($lb eq 'CB')             { $lb = 'ID' }
+    elsif ($lb =~ /^(LF|CR|NL)$/)   { $lb = 'BK' }
+    die "unknown line break class $lb" unless exists $class_index{$lb};
+    $class_of[$cp] = $class_index{$lb};
+}
+
+my (@stage1, @stage2, %block_index);
+for (my $cp = 0; $cp < $CODEPOINT_COUNT; $cp += $BLOCK_SIZE) {
+    my $key = join ',', @class_of[$cp..$cp+$BLOCK_SIZE-1];
+    unless (exists $block_index{$key}) {
+        $block_index{$key} = @stage2;
+        push @stage2, $key;
+    }
+    push @stage1, $block_index{$key};
+}
+
+my $version = Unicode::UCD::UnicodeVersion();
+print "// Generated by tools/gen_line_break.pl from the Unicode $version Line_Break\n";
+print "// property. Do not edit\n";
+print "#ifndef LINE_BREAK_H\n#define LINE_BREAK_H\n\n#include <cstdint>\n\n";
+
+print "enum LineBreakClass : uint8_t {\n";
+print "    LB_$_,\n" for @classes;
+print "};\n\n";
+
+print "// What the pair table allows between two classes. 'LB_ATTACH' means a\n";
+print "// combining mark takes the class before it (LB9)\n";
+print "enum LineBreakAction : uint8_t {\n";
+print "    LB_BREAK             = 1 << 0,\n";
+print "    LB_BREAK_AFTER_SPACE = 1 << 1,\n";
+print "    LB_ATTACH            = 1 << 2,\n";
+print "};\n\n";
+
+printf "#define LB_BLOCK_SHIFT %d\n", $BLOCK_SHIFT;
+printf "#define LB_PAIR_CLASS_COUNT %d\n\n", $pair_class_count;
+
+printf "static const uint%d_t LB_STAGE1[%d] = {\n", @stage2 > 256 ? 16 : 8, scalar @stage1;
+print_numbers(\@stage1, 16);
+print "};\n\n";
+
+printf "static const uint8_t LB_STAGE2[%d][%d] = {\n", scalar @stage2, $BLOCK_SIZE;
+for my $key (@stage2) {
+    my @values = split /,/, $key;
+    print "    {\n";
+    print_numbers(\@values, 32, 8);
+    print "    },\n";
+}
+print "};\n\n";
+
+print "// Rows are the class before, columns the class after. Bits are 'LineBreakAction'\n";
+print "static const uint8_t LB_PAIRS[LB_PAIR_CLASS_COUNT][LB_PAIR_CLASS_COUNT] = {\n";
+print "    //", join('', map { sprintf '%-3s', $_ } @classes[0..$pair_class_count-1]), "\n";
+for my $before (@classes[0..$pair_class_count-1]) {
+    my @row = map { pair_action($before, $_) } @classes[0..$pair_class_count-1];
+    printf "    { %s }, // %s\n", join(', ', @row), $before;
+}
+print "};\n\n#endif // LINE_BREAK_H\n";
+
+sub expand {
+    my ($ranges, $map) = @_;
+    my @result;
+    for my $i (0..$#$ranges) {
+        my $end = $i < $#$ranges ? $ranges->[$i+1] : $CODEPOINT_COUNT;
+        last if $ranges->[$i] >= $CODEPOINT_COUNT;
+        $end = $CODEPOINT_COUNT if $end > $CODEPOINT_COUNT;
+        $result[$_] = $map->[$i] for $ranges->[$i]..$end-1;
+    }
+    return @result;
+}
+
+sub print_numbers {
+    my ($values, $per_line, $indent) = @_;
+    $indent //= 4;
+    for (my $i = 0; $i < @$values; $i += $per_line) {
+        my $end = $i + $per_line - 1;
+        $end = $#$values if $end > $#$values;
+        print ' ' x $indent, join(',', @$values[$i..$end]), ",\n";
+    }
+}
+
+sub in { my $x = shift; return scalar grep { $_ eq $x } @_ }
+
+# Whether 'b' and 'a' can be broken between, directly or with spaces
+# between. Rules that need more than two classes (LB21a, LB30a) are left out
+sub breaks {
+    my ($b, $a, $spaced) = @_;
+    return 0 if $a eq 'ZW';                                          # LB7
+    return 1 if $b eq 'ZW';                                          # LB8
+    if ($b eq 'ZWJ') {                                               # LB8a
+        return 0 unless $spaced;
+        $b = 'AL';
+    }
+    $b = 'AL' if $b eq 'CM';                                         # LB10
+    return 0 if $a eq 'WJ' || ($b eq 'WJ' && !$spaced);              # LB11
+    return 0 if $b eq 'GL' && !$spaced;                              # LB12
+    return 0 if $a eq 'GL' && !$spaced && !in($b, qw(BA HY));        # LB12a
+    return 0 if in($a, qw(CL CP EX IS SY));                          # LB13
+    return 0 if $b eq 'OP';                                          # LB14
+    return 0 if $b eq 'QU' && $a eq 'OP';                            # LB15
+    return 0 if in($b, qw(CL CP)) && $a eq 'NS';                     # LB16
+    return 0 if $b eq 'B2' && $a eq 'B2';                            # LB17
+    return 1 if $spaced;                                             # LB18
+    return 0 if $a eq 'QU' || $b eq 'QU';                            # LB19
+    return 0 if in($a, qw(BA HY NS)) || $b eq 'BB';                  # LB21
+    return 0 if $b eq 'SY' && $a eq 'HL';                            # LB21b
+    return 0 if $a eq 'IN';                                          # LB22
+    return 0 if in($b, qw(AL HL)) && $a eq 'NU';                     # LB23
+    return 0 if $b eq 'NU' && in($a, qw(AL HL));
+    return 0 if $b eq 'PR' && in($a, qw(ID EB EM));                  # LB23a
+    return 0 if in($b, qw(ID EB EM)) && $a eq 'PO';
+    return 0 if in($b, qw(PR PO)) && in($a, qw(AL HL));              # LB24
+    return 0 if in($b, qw(AL HL)) && in($a, qw(PR PO));
+    return 0 if in($b, qw(CL CP NU)) && in($a, qw(PO PR));           # LB25
+    return 0 if in($b, qw(PO PR)) && in($a, qw(OP NU));
+    return 0 if in($b, qw(HY IS NU SY)) && $a eq 'NU';
+    return 0 if $b eq 'JL' && in($a, qw(JL JV H2 H3));               # LB26
+    return 0 if in($b, qw(JV H2)) && in($a, qw(JV JT));
+    return 0 if in($b, qw(JT H3)) && $a eq 'JT';
+    return 0 if in($b, qw(JL JV JT H2 H3)) && $a eq 'PO';            # LB27
+    return 0 if $b eq 'PR' && in($a, qw(JL JV JT H2 H3));
+    return 0 if in($b, qw(AL HL)) && in($a, qw(AL HL));              # LB28
+    return 0 if $b eq 'IS' && in($a, qw(AL HL));                     # LB29
+    return 0 if in($b, qw(AL HL NU)) && $a eq 'OP';                  # LB30
+    return 0 if $b eq 'CP' && in($a, qw(AL HL NU));
+    return 0 if $b eq 'RI' && $a eq 'RI';                            # LB30a
+    return 0 if $b eq 'EB' && $a eq 'EM';                            # LB30b
+    return 1;                                                        # LB31
+}
+
+sub pair_action {
+    my ($b, $a) = @_;
+    # A combining mark after a space is AL (LB10), otherwise it is attached
+    if (in($a, qw(CM ZWJ)) && $b ne 'ZW') {
+        return breaks($b, 'AL', 1) ? 6 : 4;
+    }
+    return (breaks($b, $a, 0) ? 1 : 0) | (breaks($b, $a, 1) ? 2 : 0);
+}